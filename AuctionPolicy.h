@@ -0,0 +1,253 @@
+//
+// Filename:        "AuctionPolicy.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This file describes the auction policies of the robot
+//                  cell environment.  A policy composes the auction phases
+//                  of the environment (announce, bid, settle) and a bid
+//                  rule (see Auctioning.h) at compile time, and each policy
+//                  is instantiated into its own step kernel.  The policy is
+//                  chosen (by name) once, when the environment is
+//                  initialized, so a step makes one indirect call and no
+//                  per-packet protocol checks.  A new policy is a new
+//                  struct and a new row in AUCTION_POLICIES.
+//
+
+// preprocessor directives
+#ifndef AUCTION_POLICY_H
+#define AUCTION_POLICY_H
+#include <string>
+#include "Environment.h"
+using namespace std;
+
+
+
+// auction policy definitions
+#define HYBRID_PUSH_FRACTION (0.1f)   // of the robots placed by push auctions
+
+
+
+// <environment auction phase templates>
+
+//
+// int settlePushAuctions<Select>(nSteps)
+// Last modified: 19Oct2026
+//
+// Settles every open push auction that has been open for the parameterized
+// number of steps (by the parameterized bid rule), returning the number of
+// auctions settled; the other auctions stay open (in order).
+//
+// Returns:     the number of auctions settled
+// Parameters:
+//      nSteps  in      the number of steps an auction stays open
+//
+template <class Select>
+int Environment::settlePushAuctions(const int nSteps)
+{
+    ProfileTimer timer(PHASE_SETTLE);
+    int nSettled = 0, nAuctions = auctions.size();
+    for (int i = 0; i < nAuctions; ++i)
+    {
+        Cell *c = auctions.front();
+        auctions.pop();
+        if (c->getAuctionStepCount() >= nSteps)
+        {
+            c->settleAuction(c->getWinningBid<Select>());
+            ++nSettled;
+        }
+        else auctions.push(c);
+    }
+    return nSettled;
+}   // settlePushAuctions<Select>(const int)
+
+
+
+//
+// int settleInsertionAuctions<Select>()
+// Last modified: 19Oct2026
+//
+// Settles every open insertion auction that does not conflict with a
+// better one (by the parameterized bid rule), returning the number of
+// auctions settled (see settleInsertionAuctions(winners)).
+//
+// Returns:     the number of auctions settled
+// Parameters:  <none>
+//
+template <class Select>
+int Environment::settleInsertionAuctions()
+{
+    ProfileTimer timer(PHASE_SETTLE);
+    vector< pair<Bid *, Robot *> > winners;
+    for (GLint i = 0; i < robots.size(); ++i)
+    {
+        Bid *b = robots[i]->getWinningBid<Select>();
+        if (b != NULL) winners.push_back(make_pair(b, robots[i]));
+    }
+    return settleInsertionAuctions(winners);
+}   // settleInsertionAuctions<Select>()
+
+
+
+// <auction policies>
+
+// the push auction policy: each cell at an end of the formation auctions
+// the next position outward, every robot bids its range to the position,
+// and each auction is settled after nSteps steps
+template <class Select, int nSteps = AUCTION_STEP_COUNT>
+struct PushAuction
+{
+    static const bool insertion = false;
+
+    static void announce(Environment &env)
+    {
+        env.announcePushAuctions();
+    }   // announce(Environment &)
+
+    static void bid(Environment &env)
+    {
+        env.bidOnPushAuctions();
+        env.stepRobots();
+    }   // bid(Environment &)
+
+    static void settle(Environment &env)
+    {
+        env.settlePushAuctions<Select>(nSteps);
+    }   // settle(Environment &)
+};  // PushAuction
+
+// the insertion auction policy: each free robot auctions itself, the cells
+// in position bid on their nearest auctions, and every auction that does
+// not conflict with a better one is settled at the end of the step
+template <class Select>
+struct InsertionAuction
+{
+    static const bool insertion = true;
+
+    static void announce(Environment &env)
+    {
+        env.announceInsertionAuctions();
+        env.stepCells();
+    }   // announce(Environment &)
+
+    static void bid(Environment &env)
+    {
+        env.bidOnInsertionAuctions();
+        env.receiveBids();
+    }   // bid(Environment &)
+
+    static void settle(Environment &env)
+    {
+        env.settleInsertionAuctions<Select>();
+    }   // settle(Environment &)
+};  // InsertionAuction
+
+// the hybrid auction policy: the formation grows from its ends by push
+// auctions until it holds HYBRID_PUSH_FRACTION of the robots (while it is
+// small, its ends are nearly every insertion point anyway), and then by
+// insertion auctions anywhere along it
+struct HybridAuction
+{
+    typedef PushAuction<LowestBid>      Push;
+    typedef InsertionAuction<LowestBid> Insertion;
+
+    static const bool insertion = false;
+
+    static void announce(Environment &env)
+    {
+        if ((!env.useInsertion()) &&
+            (env.getNCells() >= HYBRID_PUSH_FRACTION *
+                                (env.getNCells() + env.getNFreeRobots())))
+            env.setInsertion(true);
+        if (env.useInsertion()) Insertion::announce(env);
+        else                    Push::announce(env);
+    }   // announce(Environment &)
+
+    static void bid(Environment &env)
+    {
+        if (env.useInsertion()) Insertion::bid(env);
+        else                    Push::bid(env);
+    }   // bid(Environment &)
+
+    static void settle(Environment &env)
+    {
+        if (env.useInsertion()) Insertion::settle(env);
+        else                    Push::settle(env);
+    }   // settle(Environment &)
+};  // HybridAuction
+
+
+
+//
+// void auctionStep<Policy>(env)
+// Last modified: 19Oct2026
+//
+// Executes the auction phases of the parameterized policy for one step
+// of the parameterized environment (the step kernel of the policy).
+//
+// Returns:     <none>
+// Parameters:
+//      env     in/out  the environment being stepped
+//
+template <class Policy>
+void auctionStep(Environment &env)
+{
+    Policy::announce(env);
+    Policy::bid(env);
+    Policy::settle(env);
+}   // auctionStep<Policy>(Environment &)
+
+
+
+// describes an auction policy (by name) and its step kernel
+struct AuctionPolicy
+{
+    const char *name;
+    const char *title;
+    bool        insertion;          // cells start in the insertion protocol
+    void      (*step)(Environment &env);
+};  // AuctionPolicy
+
+// the auction policies (the first is the default)
+static const AuctionPolicy AUCTION_POLICIES[] =
+{
+    {"push",             "Push Auction",
+     PushAuction<LowestBid>::insertion,
+     auctionStep< PushAuction<LowestBid> >},
+    {"insertion",        "Insertion Auction",
+     InsertionAuction<LowestBid>::insertion,
+     auctionStep< InsertionAuction<LowestBid> >},
+    {"random-push",      "Random Push Auction",
+     PushAuction<RandomBid>::insertion,
+     auctionStep< PushAuction<RandomBid> >},
+    {"random-insertion", "Random Insertion Auction",
+     InsertionAuction<RandomBid>::insertion,
+     auctionStep< InsertionAuction<RandomBid> >},
+    {"hybrid",           "Hybrid Auction",
+     HybridAuction::insertion,
+     auctionStep<HybridAuction>}
+};
+static const int N_AUCTION_POLICIES =
+    sizeof(AUCTION_POLICIES) / sizeof(AUCTION_POLICIES[0]);
+
+
+
+//
+// const AuctionPolicy* findAuctionPolicy(name)
+// Last modified: 19Oct2026
+//
+// Returns the auction policy with the parameterized name,
+// or NULL if there is no such policy.
+//
+// Returns:     the auction policy (or NULL)
+// Parameters:
+//      name    in      the name of the auction policy
+//
+inline const AuctionPolicy* findAuctionPolicy(const string &name)
+{
+    for (int i = 0; i < N_AUCTION_POLICIES; ++i)
+        if (name == AUCTION_POLICIES[i].name) return &AUCTION_POLICIES[i];
+    return NULL;
+}   // findAuctionPolicy(const string &)
+
+#endif
@@ -1,8 +1,11 @@
 // preprocessor directives
 #ifndef AUCTIONING_H
 #define AUCTIONING_H
+#include <cstdlib>
+#include <vector>
 #include "Vector.h"
 #include "State.h"
+using namespace std;
 
 
 
@@ -50,5 +53,30 @@ struct Bid
     }   // Bid(const GLfloat, const GLint)
 };  // Bid
 
+
+
+// bid selection rules (the winning bid of an auction, or NULL if no bids)
+
+// the lowest bid wins (ties go to the earliest bid received)
+struct LowestBid
+{
+    static Bid* select(const vector<Bid *> &bids)
+    {
+        Bid *winningBid = bids.empty() ? NULL : bids[0];
+        for (GLint i = 1; i < bids.size(); ++i)
+            if (bids[i]->b_i < winningBid->b_i) winningBid = bids[i];
+        return winningBid;
+    }   // select(const vector<Bid *> &)
+};  // LowestBid
+
+// a bid chosen uniformly at random wins
+struct RandomBid
+{
+    static Bid* select(const vector<Bid *> &bids)
+    {
+        return bids.empty() ? NULL : bids[rand() % bids.size()];
+    }   // select(const vector<Bid *> &)
+};  // RandomBid
+
 #endif
 
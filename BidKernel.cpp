@@ -0,0 +1,359 @@
+//
+// Filename:        "BidKernel.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements a batched bid evaluation kernel.
+//
+
+// preprocessor directives
+#include <cmath>
+#include "BidKernel.h"
+
+
+
+// <constructors>
+
+//
+// BidKernel()
+// Last modified: 19Oct2026
+//
+// Default constructor that initializes an empty kernel.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+BidKernel::BidKernel(): nNearest(0)
+{
+}   // BidKernel()
+
+
+
+// <public mutator functions>
+
+//
+// void clear()
+// Last modified: 19Oct2026
+//
+// Clears the auctions, bidders, and results (keeping their storage).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void BidKernel::clear()
+{
+    ox.clear();
+    oy.clear();
+    tx.clear();
+    ty.clear();
+    auctionIDs.clear();
+    bx.clear();
+    by.clear();
+    bidderIDs.clear();
+    ranges.clear();
+    nearest.clear();
+    nearestRanges.clear();
+    nNearest = 0;
+}   // clear()
+
+
+
+//
+// int addAuction(id, x, y, dx, dy)
+// Last modified: 19Oct2026
+//
+// Adds an auction held at the parameterized position for the position
+// offset from it, returning the index of the auction.
+//
+// Returns:     the index of the auction
+// Parameters:
+//      id      in      the ID of the auctioneer
+//      x       in      the x-coordinate of the auctioneer
+//      y       in      the y-coordinate of the auctioneer
+//      dx      in      the x-offset of the position being auctioned
+//      dy      in      the y-offset of the position being auctioned
+//
+int BidKernel::addAuction(const int   id,
+                          const float x,
+                          const float y,
+                          const float dx,
+                          const float dy)
+{
+    ox.push_back(x);
+    oy.push_back(y);
+    tx.push_back(x + dx);
+    ty.push_back(y + dy);
+    auctionIDs.push_back(id);
+    return (int)auctionIDs.size() - 1;
+}   // addAuction(const int, const float..<4>)
+
+
+
+//
+// int addBidder(id, x, y)
+// Last modified: 19Oct2026
+//
+// Adds a bidder at the parameterized position,
+// returning the index of the bidder.
+//
+// Returns:     the index of the bidder
+// Parameters:
+//      id      in      the ID of the bidder
+//      x       in      the x-coordinate of the bidder
+//      y       in      the y-coordinate of the bidder
+//
+int BidKernel::addBidder(const int id, const float x, const float y)
+{
+    bx.push_back(x);
+    by.push_back(y);
+    bidderIDs.push_back(id);
+    return (int)bidderIDs.size() - 1;
+}   // addBidder(const int, const float, const float)
+
+
+
+//
+// void computeRanges(maxRange)
+// Last modified: 19Oct2026
+//
+// Computes the range from every bidder to every position being auctioned
+// (BID_OUT_RANGE if the bidder is beyond the range of the auctioneer).
+//
+// Returns:     <none>
+// Parameters:
+//      maxRange    in      the sensor range of an auctioneer
+//
+void BidKernel::computeRanges(const float maxRange)
+{
+    int nAuctions = getNAuctions(), nBidders = getNBidders();
+    float *row = NULL;
+    ranges.resize((size_t)nAuctions * nBidders);
+    for (int b = 0; b < nBidders; ++b)
+    {
+        row = ranges.data() + (size_t)b * nAuctions;
+        computeRow(b, maxRange * maxRange, row);
+    }
+}   // computeRanges(const float)
+
+
+
+//
+// void computeNearest(k, maxRange)
+// Last modified: 19Oct2026
+//
+// Computes the (up to) k nearest positions being auctioned of each bidder,
+// nearest first (ties go to the earlier auction), skipping auctioneers
+// beyond range.
+//
+// Returns:     <none>
+// Parameters:
+//      k           in      the number of nearest auctions per bidder
+//      maxRange    in      the sensor range of an auctioneer
+//
+void BidKernel::computeNearest(const int k, const float maxRange)
+{
+    int nAuctions = getNAuctions(), nBidders = getNBidders();
+    nNearest = (k < 0) ? 0 : k;
+    nearest.assign((size_t)nNearest * nBidders, BID_NONE);
+    nearestRanges.assign((size_t)nNearest * nBidders, BID_OUT_RANGE);
+    if (nNearest == 0) return;
+    ranges.resize(nAuctions);
+    for (int b = 0; b < nBidders; ++b)
+    {
+        computeRow(b, maxRange * maxRange, ranges.data());
+
+        // insertion-select the k nearest (k is small)
+        int   *idx = &nearest[(size_t)b * nNearest];
+        float *rng = &nearestRanges[(size_t)b * nNearest];
+        int    n   = 0;
+        for (int a = 0; a < nAuctions; ++a)
+        {
+            float r = ranges[a];
+            if ((r < 0.0f) || ((n == nNearest) && (r >= rng[n - 1]))) continue;
+            int i = (n < nNearest) ? n++ : n - 1;
+            for (; (i > 0) && (rng[i - 1] > r); --i)
+            {
+                idx[i] = idx[i - 1];
+                rng[i] = rng[i - 1];
+            }
+            idx[i] = a;
+            rng[i] = r;
+        }
+    }
+    ranges.clear();
+}   // computeNearest(const int, const float)
+
+
+
+// <public accessor functions>
+
+//
+// int getNAuctions() const
+// Last modified: 19Oct2026
+//
+// Returns the number of auctions.
+//
+// Returns:     the number of auctions
+// Parameters:  <none>
+//
+int BidKernel::getNAuctions() const
+{
+    return (int)auctionIDs.size();
+}   // getNAuctions() const
+
+
+
+//
+// int getNBidders() const
+// Last modified: 19Oct2026
+//
+// Returns the number of bidders.
+//
+// Returns:     the number of bidders
+// Parameters:  <none>
+//
+int BidKernel::getNBidders() const
+{
+    return (int)bidderIDs.size();
+}   // getNBidders() const
+
+
+
+//
+// int getAuctionID(a) const
+// Last modified: 19Oct2026
+//
+// Returns the ID of the auctioneer of the parameterized auction.
+//
+// Returns:     the ID of the auctioneer
+// Parameters:
+//      a       in      the index of the auction
+//
+int BidKernel::getAuctionID(const int a) const
+{
+    return auctionIDs[a];
+}   // getAuctionID(const int) const
+
+
+
+//
+// int getBidderID(b) const
+// Last modified: 19Oct2026
+//
+// Returns the ID of the parameterized bidder.
+//
+// Returns:     the ID of the bidder
+// Parameters:
+//      b       in      the index of the bidder
+//
+int BidKernel::getBidderID(const int b) const
+{
+    return bidderIDs[b];
+}   // getBidderID(const int) const
+
+
+
+//
+// float getRange(b, a) const
+// Last modified: 19Oct2026
+//
+// Returns the range from the parameterized bidder to the position being
+// auctioned (or BID_OUT_RANGE), as of the last call to computeRanges().
+//
+// Returns:     the range from the bidder to the position (or BID_OUT_RANGE)
+// Parameters:
+//      b       in      the index of the bidder
+//      a       in      the index of the auction
+//
+float BidKernel::getRange(const int b, const int a) const
+{
+    return ranges[(size_t)b * getNAuctions() + a];
+}   // getRange(const int, const int) const
+
+
+
+//
+// int getNNearest() const
+// Last modified: 19Oct2026
+//
+// Returns the number of nearest auctions kept per bidder,
+// as of the last call to computeNearest().
+//
+// Returns:     the number of nearest auctions per bidder
+// Parameters:  <none>
+//
+int BidKernel::getNNearest() const
+{
+    return nNearest;
+}   // getNNearest() const
+
+
+
+//
+// int getNearest(b, i) const
+// Last modified: 19Oct2026
+//
+// Returns the index of the i-th nearest auction of the parameterized
+// bidder (or BID_NONE), as of the last call to computeNearest().
+//
+// Returns:     the index of the auction (or BID_NONE)
+// Parameters:
+//      b       in      the index of the bidder
+//      i       in      the rank of the auction (0 is nearest)
+//
+int BidKernel::getNearest(const int b, const int i) const
+{
+    return nearest[(size_t)b * nNearest + i];
+}   // getNearest(const int, const int) const
+
+
+
+//
+// float getNearestRange(b, i) const
+// Last modified: 19Oct2026
+//
+// Returns the range to the i-th nearest auction of the parameterized
+// bidder (or BID_OUT_RANGE), as of the last call to computeNearest().
+//
+// Returns:     the range to the auction (or BID_OUT_RANGE)
+// Parameters:
+//      b       in      the index of the bidder
+//      i       in      the rank of the auction (0 is nearest)
+//
+float BidKernel::getNearestRange(const int b, const int i) const
+{
+    return nearestRanges[(size_t)b * nNearest + i];
+}   // getNearestRange(const int, const int) const
+
+
+
+// <protected utility functions>
+
+//
+// void computeRow(b, maxRange2, row) const
+// Last modified: 19Oct2026
+//
+// Computes the range from the parameterized bidder to every position being
+// auctioned; the loop is branch-free over flat arrays so that the compiler
+// vectorizes it.
+//
+// Returns:     <none>
+// Parameters:
+//      b           in      the index of the bidder
+//      maxRange2   in      the squared sensor range of an auctioneer
+//      row         out     the ranges to the auctions (or BID_OUT_RANGE)
+//
+void BidKernel::computeRow(const int b, const float maxRange2, float *row) const
+{
+    const int    n   = getNAuctions();
+    const float  x   = bx[b], y = by[b];
+    const float *pox = ox.data(), *poy = oy.data();
+    const float *ptx = tx.data(), *pty = ty.data();
+    for (int a = 0; a < n; ++a)
+    {
+        float ux = x - pox[a], uy = y - poy[a];
+        float vx = x - ptx[a], vy = y - pty[a];
+        float r  = sqrtf(vx * vx + vy * vy);
+        row[a]   = (ux * ux + uy * uy > maxRange2) ? BID_OUT_RANGE : r;
+    }
+}   // computeRow(const int, const float, float *) const
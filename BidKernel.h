@@ -0,0 +1,72 @@
+//
+// Filename:        "BidKernel.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes a batched bid evaluation kernel
+//                  that gathers the open auctions and the bidders of a step
+//                  into flat coordinate arrays and computes every bid range
+//                  (or the nearest auctions of each bidder) in one pass.
+//
+
+// preprocessor directives
+#ifndef BID_KERNEL_H
+#define BID_KERNEL_H
+#include <vector>
+using namespace std;
+
+
+
+// bid kernel definitions
+#define BID_NONE       (-1)      // no auction (unused nearest slot)
+#define BID_OUT_RANGE  (-1.0f)   // range of an auction beyond sensor range
+
+
+
+// describes a batched bid evaluation kernel (structure of arrays)
+class BidKernel
+{
+    public:
+
+        // <constructors>
+        BidKernel();
+
+        // <public mutator functions>
+        void clear();
+        int  addAuction(const int   id,
+                        const float x,
+                        const float y,
+                        const float dx = 0.0f,
+                        const float dy = 0.0f);
+        int  addBidder(const int id, const float x, const float y);
+        void computeRanges(const float maxRange);
+        void computeNearest(const int k, const float maxRange);
+
+        // <public accessor functions>
+        int   getNAuctions()                          const;
+        int   getNBidders()                           const;
+        int   getAuctionID(const int a)               const;
+        int   getBidderID(const int b)                const;
+        float getRange(const int b, const int a)      const;
+        int   getNNearest()                           const;
+        int   getNearest(const int b, const int i)    const;
+        float getNearestRange(const int b, const int i) const;
+
+    protected:
+
+        // <protected data members>
+        vector<float> ox, oy;       // auctioneer positions
+        vector<float> tx, ty;       // positions being auctioned
+        vector<int>   auctionIDs;
+        vector<float> bx, by;       // bidder positions
+        vector<int>   bidderIDs;
+        vector<float> ranges;       // bidder-major range matrix
+        vector<int>   nearest;      // bidder-major nearest auctions
+        vector<float> nearestRanges;
+        int           nNearest;
+
+        // <protected utility functions>
+        void computeRow(const int b, const float maxRange2, float *row) const;
+};  // BidKernel
+
+#endif
@@ -72,6 +72,8 @@ Cell::Cell(const Cell &c): State(c), Neighborhood(c), Robot(c)
     rightNbr = c.rightNbr;
     lftNbrID = c.lftNbrID;
     rghtNbrID = c.rghtNbrID;
+    upstreamID = c.upstreamID;
+    upstreamFID = c.upstreamFID;
 }   // Cell(const Cell &)
 
 
@@ -174,6 +176,7 @@ bool Cell::setRobotP(Robot *r)
 //
 State Cell::getState() const
 {
+    Profiler::countStateCopy();
     return (State)*this;
 }   // getState() const
 
@@ -268,7 +271,10 @@ Cell* Cell::cStep()
         //cout << "done here 2" << endl;
         updateState();
         //cout << "done here 3" << endl;
-        sendStateToNbrs();
+
+        // (in discrete message passing, the environment has every cell
+        // send its state after every cell has moved, see sendCellStates())
+        if (!env->useDiscrete()) sendStateToNbrs();
         //cout << "done here 4" << endl;
     }
 	}
@@ -309,10 +315,9 @@ Cell* Cell::cStep()
                 }
             }
         //}
-	}else{
-	    bidOnInsertionAuction();
-	    //cout << "finished call to bidOnInsertionAuction()" << endl;
 	}
+	// (in insertion mode, the environment has cells bid in one batch
+	// after every cell has stepped, see bidOnInsertionAuction())
 	//insertion_auctions.clear();
 	/*if(CELL_INFO_VIEW)
 	{
@@ -375,8 +380,16 @@ void Cell::updateState()
         currNbr = getNbr(i);
         if (currNbr == NULL) break;
 
-        // change formation if a neighbor has changed formation
-        if ((currNbr->formation.getFormationID() > formation.getFormationID()))//&&(currNbr->ID == nbrWithMinGradient()->ID))
+        // change formation if the upstream neighbor (toward the seed) has
+        // changed formation since this cell last followed it, so that a
+        // change made at an insertion point only travels downstream; any
+        // newer neighbor will do if the formation has a new seed or this
+        // cell has no upstream neighbor yet
+        if ((currNbr->ID == upstreamID) ?
+            (currNbr->formation.getFormationID() != upstreamFID) :
+            ((currNbr->formation.getFormationID() > formation.getFormationID()) &&
+             ((currNbr->formation.getSeedID() != formation.getSeedID()) ||
+              ((upstreamID == DEFAULT_NEIGHBOR_ID) && (formation.getSeedID() != ID)))))
         {
             /*if((ID ==3)||(ID==2))
             {
@@ -464,7 +477,7 @@ void Cell::updateState()
 
 /*void Cell::updateState()
 {
-	if(VERBOSE) printf("entering updateState()\n");
+	LOG(LOG_TRACE, LOG_CELL, "entering updateState()");
     Neighbor currNbr;
     for (GLint i = 0; i < getNNbrs(); ++i)
     {
@@ -480,9 +493,9 @@ void Cell::updateState()
 
     // reference the neighbor with the smallest gradient
     // to establish correct position in formation
-	if(VERBOSE) printf("updateState() -- BEFORE nbrWithMinGradient()\n");
+	LOG(LOG_TRACE, LOG_CELL, "updateState() -- BEFORE nbrWithMinGradient()");
     Neighbor     *refNbr = nbrWithMinGradient(formation.getSeedGradient());
-	if(VERBOSE) printf("updateState() -- AFTER nbrWithMinGradient()\n");
+	LOG(LOG_TRACE, LOG_CELL, "updateState() -- AFTER nbrWithMinGradient()");
 	Relationship *nbrRel;
 	if(refNbr == NULL){
 		//printf("refNbr == NULL\n");
@@ -490,7 +503,7 @@ void Cell::updateState()
 		nbrRel = relWithID(refNbr->rels, ID);
 
 
-		if(VERBOSE) printf("updateState() -- AFTER relWithID()\n");
+		LOG(LOG_TRACE, LOG_CELL, "updateState() -- AFTER relWithID()");
 	}
     if ((formation.getSeedID() != ID) && (refNbr != NULL) && (nbrRel != NULL))
     {
@@ -513,7 +526,7 @@ void Cell::updateState()
             else moveStop();
     }
     else moveStop();
-	if(VERBOSE) printf("leaving updateState()\n");
+	LOG(LOG_TRACE, LOG_CELL, "leaving updateState()");
 }   // updateState()*/
 
 
@@ -539,6 +552,7 @@ bool Cell::changeFormation(const Formation &f, Neighbor n)
     formation = f;
     if (formation.getSeedID() == ID)
     {
+        upstreamID = upstreamFID = DEFAULT_NEIGHBOR_ID;
         gradient   = formation.getSeedGradient();
         transError = Vector();
         rotError   = 0.0f;
@@ -557,8 +571,9 @@ bool Cell::changeFormation(const Formation &f, Neighbor n)
         //cout << " which makes my grad = " << gradient << endl;
         transError               = Vector();
         rotError                 = 0.0f;
+        upstreamID               = n.ID;
+        upstreamFID              = n.formation.getFormationID();
     }
-    vector<Vector> r = formation.getRelationships(gradient);
     {
 
     /*cout << "For Cell["<<ID<<"]"<<endl;
@@ -670,8 +685,7 @@ bool Cell::changeFormation(const Formation &f, Neighbor n)
     --ROSS--*/
     }
     Relationship rLeft,rRight;
-    if (leftNbr  != NULL) leftNbr->relDesired  = r[LEFT_NBR_INDEX];
-    if (rightNbr != NULL) rightNbr->relDesired = r[RIGHT_NBR_INDEX];
+    refreshRelationships();
     /*if(r.size()>2)
     {
         showNeighbors();
@@ -706,6 +720,58 @@ bool Cell::changeFormation(const Formation &f, Neighbor n)
     //if (rightNbr != NULL) rightNbr->relDesired = nbrWithID(rghtNbrID)->relDesired;//r[rghtNbrID];
     return true;
 }   // changeFormation(const Formation &, Neighbor)
+
+
+
+//
+// bool refreshRelationships()
+// Last modified: 19Oct2026
+//
+// Recomputes the desired relationships to the left and right neighbors
+// from the current formation and gradient (e.g., after a new neighbor has
+// been spliced in), returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Cell::refreshRelationships()
+{
+    if (lftNbrID  != DEFAULT_NEIGHBOR_ID) leftNbr  = nbrWithID(lftNbrID);
+    if (rghtNbrID != DEFAULT_NEIGHBOR_ID) rightNbr = nbrWithID(rghtNbrID);
+
+    vector<Vector> r = formation.getRelationships(gradient);
+    if (r.size() < NEIGHBORHOOD_SIZE) return false;
+    if (leftNbr  != NULL) leftNbr->relDesired  = r[LEFT_NBR_INDEX];
+    if (rightNbr != NULL) rightNbr->relDesired = r[RIGHT_NBR_INDEX];
+    rels = getRelationships();
+    return true;
+}   // refreshRelationships()
+
+
+
+//
+// bool senseNbrs()
+// Last modified: 19Oct2026
+//
+// Measures the actual relationships to the neighbors of the cell (as
+// updateState() does, without updating the state of the cell), so that
+// the state sent next reflects where the cell and its neighbors are now,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Cell::senseNbrs()
+{
+    for (GLint i = 0; i < size(); ++i)
+    {
+        Neighbor *currNbr = getNbr(i);
+        if (currNbr == NULL) break;
+        currNbr->relActual = getRelationship(currNbr->ID);
+    }
+    rels = getRelationships();
+    return true;
+}   // senseNbrs()
 
 
 void Cell::setNbrIndex()
@@ -747,10 +813,10 @@ void Cell::setNbrIndex()
 bool Cell::sendStateToNbrs()
 {
     Neighbor curr;
-	if(VERBOSE)printf("cellID=%d\n",getID());
+	LOG(LOG_TRACE, LOG_CELL, "cellID=%d",getID());
     for (GLint i = 0; i < getNNbrs(); ++i)
 	{
-		if(VERBOSE)printf("sending state to id= %d\n",getNbr(i)->ID);
+		LOG(LOG_TRACE, LOG_CELL, "sending state to id= %d",getNbr(i)->ID);
 
 		//if((getNbr(i)->ID)==NULL
 		//if(VERBOSE)printf("
@@ -838,9 +904,6 @@ bool Cell::processPacket(Packet &p)
 			success  = changeFormation(*((Formation *)p.msg));
 	}else if(p.type == PUSH_AUCTION_ANNOUNCEMENT)
 	{
-		if(ALLOW_CELL_BIDS)
-		{
-		}
 		success = true;
 	}
 	else if(p.type ==INSERTION_AUCTION_ANNOUNCEMENT)
@@ -1065,6 +1128,7 @@ bool Cell::init(const GLfloat dx,    const GLfloat dy, const GLfloat dz,
     showFilled = DEFAULT_CELL_SHOW_FILLED;
     leftNbr    = rightNbr = NULL;
     lftNbrID = rghtNbrID = DEFAULT_NEIGHBOR_ID;
+    upstreamID = upstreamFID = DEFAULT_NEIGHBOR_ID;
     auctionStepCount = 0;
     insertion = ins;
     converged = -1;
@@ -1076,43 +1140,34 @@ bool Cell::init(const GLfloat dx,    const GLfloat dy, const GLfloat dz,
 }   // init(const GLfloat..<4>, const Color)
 
 
-void Cell::settleAuction()
+//
+// void settleAuction(winningBid)
+// Last modified: 19Oct2026
+//
+// Closes the open push auction of this cell, placing the robot of the
+// parameterized winning bid (chosen by the bid rule of the auction policy,
+// see Environment::settlePushAuctions()) if it is still free.
+//
+// Returns:     <none>
+// Parameters:
+//      winningBid  in      the winning bid (or NULL to close unsettled)
+//
+void Cell::settleAuction(const Bid *winningBid)
 {
 	//cout << "Cell::settleAuction() entered\n"<< endl;
 	auctionStepCount = 0;
-	if(bids.size()<=0)
+	if(winningBid == NULL)
 	{
+		bids.clear();
 		return;
 	}
-	Bid* winningBid;
-	//srand(time(NULL));
-	//winningBid = bids[rand()%bids.size()];
-
-
-
-
-	winningBid = bids[0];
-    if(PUSH_RANDOM)
-    {
-        srand(time(NULL));
-        int windex = rand() % bids.size();
-        winningBid = bids[windex];
-    } else {
-        for(int i=0;i<bids.size();i++)
-        {
-            if(bids[i]->b_i < winningBid->b_i)
-            {
-                winningBid = bids[i];
-            }
-        }
-    }
 	//cout <<"Robot # "<<winningBid->rID<<" won the auction" << endl;
 	if(env->getRobot(winningBid->bID))
 	{
         env->settlePushAuction(this,winningBid->bID);
 	}
 	bids.clear();
-}
+}   // settleAuction(const Bid *)
 
 GLint Cell::getNBids() const
 {
@@ -1277,76 +1332,56 @@ bool Cell::neighborsInPosition() const
     return rightN && leftN;
 }
 
-bool Cell::bidOnInsertionAuction()
+//
+// bool canBidOnInsertionAuction() const
+// Last modified: 19Oct2026
+//
+// Returns true if this cell is in position (and has not yet bid this
+// step), so that it may bid on insertion auctions, false otherwise.
+//
+// Returns:     true if this cell may bid, false otherwise
+// Parameters:  <none>
+//
+bool Cell::canBidOnInsertionAuction() const
+{
+    return (!outstandingBid) &&
+           (getState().transError.magnitude() < max_trans_error);
+}   // canBidOnInsertionAuction() const
+
+
+
+//
+// bool bidOnInsertionAuction(kernel, b)
+// Last modified: 19Oct2026
+//
+// Bids on the nearest insertion auctions of this cell (ranked by the
+// batched bid kernel of the step, see Environment::bidOnInsertionAuctions()),
+// returning true if any bid was sent, false otherwise.  Bidding on the
+// nearest few lets the formation win several auctions at once.
+//
+// Returns:     true if any bid was sent, false otherwise
+// Parameters:
+//      kernel  in      the bid kernel of the step
+//      b       in      the index of this cell as a bidder in the kernel
+//
+bool Cell::bidOnInsertionAuction(const BidKernel &kernel, const GLint b)
 {
     bool answer = false;
-    //cout << "cStep - insertion stuff" << endl;
-    if((getState().transError.magnitude() < max_trans_error))//&&(ID == 0))//formation.getSeedID()))
+    if(!canBidOnInsertionAuction()) return false;
+    for(int i=0;(i<kernel.getNNearest())&&(i<INSERTION_MAX_BIDS);i++)
     {
-        //cout << "Cell["<<ID<<"] has "<<insertion_auctions.size() << " auction announcements   ||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||" << endl;
-        if(insertion_auctions.size()>0)
-        {
-            //displayInsertionAuctions();
-            //if((neighborsInPosition())&&(timeOfLastAuction + AUCTION_BACKOFF < env->stepCount))
-            //{
-                if(!outstandingBid)
-                {
-                    //cout << "deeper into bid process" << endl;
-                    GLfloat shortestRange = 99999999.0;
-                    GLint nearestAuction = -2;
-                    if(insertion_auctions.size()>1)
-                    {
-                        //cout << "heresies" << endl;
-                        for(int i=0;i<insertion_auctions.size();i++)
-                        {
-                            if(!env->getRobot(insertion_auctions[i]->aID))
-                            {
-                                //cout << "skipping robot #: " << insertion_auctions[i]->aID << endl;
-                                continue;
-                            }
-                            GLfloat range = env->distanceToRobot(this, env->getRobot(insertion_auctions[i]->aID));
-                            //cout << "in heresies   range = " << range << endl;
-                            if (range<shortestRange)
-                            {
-
-                                shortestRange = range;
-                                nearestAuction = insertion_auctions[i]->aID;
-                                //cout << "Robot["<<nearestAuction<<"] is the nearest auction..." << endl;
-                            }
-                        }
-                    }else{
-                        if(!env->getRobot(insertion_auctions[0]->aID))
-                        {
-                            //cout << "no auctions with existing robots" << endl;
-                        } else {
-                            nearestAuction = insertion_auctions[0]->aID;
-                            shortestRange = env->distanceToRobot(this, env->getRobot(nearestAuction));
-                        }
-                    }
-                    if(nearestAuction == -2)
-                    {
-                        //cout << "nearestAuction was for a non-existant robot." << endl;
-                    } else {
-                        //cout << "outside of search for closest auction" << endl;
-                        GLfloat range = shortestRange;
-                        GLfloat b_j = E * range;
-                        Bid    *b   = new Bid(b_j, getID());
-                        //cout << "Bid b_i = " << b->b_i << " bID = " << b->bID << endl;
-                        env->sendMsg(b, nearestAuction, ID, BID);
-                        outstandingBid = 1;
-                        //cout << "sent bid to robot["<<nearestAuction<<"] EEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEEE"<< endl;
-                        //insertion_auctions.clear();
-                        answer = true;
-                    }
-                } else {
-                    //cout << "found an outstanding bid, not proceeding" << endl;
-                }
-            //}
-            insertion_auctions.clear();
-        }
+        GLint a = kernel.getNearest(b, i);
+        if(a == BID_NONE) break;
+        GLfloat b_j = E * kernel.getNearestRange(b, i);
+        Bid    *bid = new Bid(b_j, getID());
+        //cout << "Bid b_i = " << bid->b_i << " bID = " << bid->bID << endl;
+        Trace::instant("bid", "auction", "cell", ID, "robot", kernel.getAuctionID(a));
+        env->sendMsg(bid, kernel.getAuctionID(a), ID, BID);
+        outstandingBid = 1;
+        answer = true;
     }
     return answer;
-}
+}   // bidOnInsertionAuction(const BidKernel &, const GLint)
 
 void Cell::displayInsertionAuctions()
 {
@@ -12,6 +12,7 @@
 #define CELL_H
 #include <vector>
 #include "Auctioning.h"
+#include "Logger.h"
 #include "Neighborhood.h"
 #include "Robot.h"
 using namespace std;
@@ -19,14 +20,14 @@ using namespace std;
 
 
 //
-#define VERBOSE            (0)
 #define AUTONOMOUS_INIT    (1)
-#define ALLOW_CELL_BIDS    (0)
 #define CELL_INFO_VIEW     (0)
 #define AUCTION_STEP_COUNT (3)
-#define INSERTION          (1)
 #define DEFAULT_NEIGHBOR_ID (-1)
 #define AUCTION_BACKOFF    (2)
+#define INSERTION_MAX_BIDS (3)   // nearest insertion auctions bid on per step
+#define AUCTION_BACKOFF_MAX (4)   // longest wait after unanswered auctions
+#define AUCTION_ANNOUNCE_BUDGET (16)  // insertion announcements per step
 
 
 
@@ -41,7 +42,8 @@ enum MessageType
     BID,
     BUMP,
     NEW_NEIGHBOR,
-    DROP_NEIGHBOR
+    DROP_NEIGHBOR,
+    N_MESSAGE_TYPES
 };  // MessageType
 
 enum Direction
@@ -99,7 +101,8 @@ class Cell: public State, public Neighborhood, public Robot
         float        getDistanceTraveled() const;
         bool         neighborsInPosition() const;
         void         displayInsertionAuctions();
-        bool         bidOnInsertionAuction();
+        bool         canBidOnInsertionAuction() const;
+        bool         bidOnInsertionAuction(const BidKernel &kernel, const GLint b);
         int          convergedAt();
 
 
@@ -117,6 +120,8 @@ class Cell: public State, public Neighborhood, public Robot
         // <virtual public neighborhood functions>
         virtual bool changeFormation(const Formation &f,
                                      Neighbor         n = Neighbor());
+        virtual bool refreshRelationships();
+        virtual bool senseNbrs();
         virtual bool sendStateToNbrs();
         virtual bool sendState(const GLint);
         virtual bool processPackets();
@@ -144,6 +149,8 @@ class Cell: public State, public Neighborhood, public Robot
         GLint          numAuctions;
         Neighbor     *leftNbr, *rightNbr;
         int           lftNbrID, rghtNbrID;
+        int           upstreamID;   // the neighbor toward the seed
+        int           upstreamFID;  // its formation ID when last adopted
         GLint         index;
         GLint         numBids;
         int           auctionStepCount;
@@ -157,7 +164,15 @@ class Cell: public State, public Neighborhood, public Robot
         static GLint nCells;
 
         // <protected utility functions>
-        void settleAuction();
+        void settleAuction(const Bid *winningBid);
+
+        // the winning bid of the open push auction of this cell
+        // (by the parameterized bid rule, see Auctioning.h)
+        template <class Select>
+        Bid* getWinningBid() const
+        {
+            return Select::select(bids);
+        }   // getWinningBid() const
 
         void updateDistanceTraveled();
 
@@ -0,0 +1,413 @@
+//
+// Filename:        "ChainIndex.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements an order-statistics index over
+//                  the formation chain.
+//
+
+// preprocessor directives
+#include "ChainIndex.h"
+
+
+
+// <constructors>
+
+//
+// ChainIndex()
+// Last modified: 19Oct2026
+//
+// Default constructor that initializes an empty chain.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+ChainIndex::ChainIndex(): root(CHAIN_NONE), nNodes(0), rngState(2463534242U)
+{
+}   // ChainIndex()
+
+
+
+// <public mutator functions>
+
+//
+// bool insertFirst(id)
+// Last modified: 19Oct2026
+//
+// Attempts to start the chain with the parameterized cell,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      id      in      the ID of the cell being inserted
+//
+bool ChainIndex::insertFirst(const int id)
+{
+    return (nNodes == 0) && (insertAt(0, id));
+}   // insertFirst(const int)
+
+
+
+//
+// bool insertAfter(nbrID, id)
+// Last modified: 19Oct2026
+//
+// Attempts to insert the parameterized cell immediately to the right of
+// the neighbor cell, returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      nbrID   in      the ID of the neighbor already in the chain
+//      id      in      the ID of the cell being inserted
+//
+bool ChainIndex::insertAfter(const int nbrID, const int id)
+{
+    return (contains(nbrID)) && (insertAt(getPosition(nbrID) + 1, id));
+}   // insertAfter(const int, const int)
+
+
+
+//
+// bool insertBefore(nbrID, id)
+// Last modified: 19Oct2026
+//
+// Attempts to insert the parameterized cell immediately to the left of
+// the neighbor cell, returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      nbrID   in      the ID of the neighbor already in the chain
+//      id      in      the ID of the cell being inserted
+//
+bool ChainIndex::insertBefore(const int nbrID, const int id)
+{
+    return (contains(nbrID)) && (insertAt(getPosition(nbrID), id));
+}   // insertBefore(const int, const int)
+
+
+
+//
+// bool remove(id)
+// Last modified: 19Oct2026
+//
+// Attempts to remove the parameterized cell from the chain (joining its
+// neighbors), returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      id      in      the ID of the cell being removed
+//
+bool ChainIndex::remove(const int id)
+{
+    if (!contains(id)) return false;
+    int l, m, r;
+    split(root, getPosition(id), l, r);
+    split(r, 1, m, r);
+    root = merge(l, r);
+    if (root != CHAIN_NONE) nodes[root].parent = CHAIN_NONE;
+    nodes[id].used = false;
+    --nNodes;
+    return true;
+}   // remove(const int)
+
+
+
+//
+// void clear()
+// Last modified: 19Oct2026
+//
+// Clears the chain.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void ChainIndex::clear()
+{
+    nodes.clear();
+    root   = CHAIN_NONE;
+    nNodes = 0;
+}   // clear()
+
+
+
+// <public accessor functions>
+
+//
+// bool contains(id) const
+// Last modified: 19Oct2026
+//
+// Returns true if the parameterized cell is in the chain, false otherwise.
+//
+// Returns:     true if the cell is in the chain, false otherwise
+// Parameters:
+//      id      in      the ID of the cell
+//
+bool ChainIndex::contains(const int id) const
+{
+    return (id >= 0) && (id < (int)nodes.size()) && (nodes[id].used);
+}   // contains(const int) const
+
+
+
+//
+// int getSize() const
+// Last modified: 19Oct2026
+//
+// Returns the number of cells in the chain.
+//
+// Returns:     the number of cells in the chain
+// Parameters:  <none>
+//
+int ChainIndex::getSize() const
+{
+    return nNodes;
+}   // getSize() const
+
+
+
+//
+// int getPosition(id) const
+// Last modified: 19Oct2026
+//
+// Returns the position (from the left, starting at 0) of the
+// parameterized cell, or CHAIN_NONE if it is not in the chain.
+//
+// Returns:     the position of the cell (or CHAIN_NONE)
+// Parameters:
+//      id      in      the ID of the cell
+//
+int ChainIndex::getPosition(const int id) const
+{
+    if (!contains(id)) return CHAIN_NONE;
+    int pos = sizeOf(nodes[id].left);
+    for (int n = id; nodes[n].parent != CHAIN_NONE; n = nodes[n].parent)
+        if (nodes[nodes[n].parent].right == n)
+            pos += sizeOf(nodes[nodes[n].parent].left) + 1;
+    return pos;
+}   // getPosition(const int) const
+
+
+
+//
+// int getIDAt(pos) const
+// Last modified: 19Oct2026
+//
+// Returns the ID of the cell at the parameterized position
+// (from the left, starting at 0), or CHAIN_NONE if out of range.
+//
+// Returns:     the ID of the cell at the position (or CHAIN_NONE)
+// Parameters:
+//      pos     in      the position in the chain
+//
+int ChainIndex::getIDAt(const int pos) const
+{
+    if ((pos < 0) || (pos >= nNodes)) return CHAIN_NONE;
+    int n = root, k = pos;
+    while (n != CHAIN_NONE)
+    {
+        int nLeft = sizeOf(nodes[n].left);
+        if (k == nLeft) return n;
+        if (k < nLeft) n = nodes[n].left;
+        else
+        {
+            k -= nLeft + 1;
+            n  = nodes[n].right;
+        }
+    }
+    return CHAIN_NONE;
+}   // getIDAt(const int) const
+
+
+
+//
+// int getNLeftOf(id) const
+// Last modified: 19Oct2026
+//
+// Returns the number of cells to the left of the parameterized cell
+// (its hop count to the left end of the chain).
+//
+// Returns:     the number of cells to the left of the cell
+// Parameters:
+//      id      in      the ID of the cell
+//
+int ChainIndex::getNLeftOf(const int id) const
+{
+    return contains(id) ? getPosition(id) : 0;
+}   // getNLeftOf(const int) const
+
+
+
+//
+// int getNRightOf(id) const
+// Last modified: 19Oct2026
+//
+// Returns the number of cells to the right of the parameterized cell
+// (its hop count to the right end of the chain).
+//
+// Returns:     the number of cells to the right of the cell
+// Parameters:
+//      id      in      the ID of the cell
+//
+int ChainIndex::getNRightOf(const int id) const
+{
+    return contains(id) ? nNodes - 1 - getPosition(id) : 0;
+}   // getNRightOf(const int) const
+
+
+
+// <protected utility functions>
+
+//
+// unsigned int nextPriority()
+// Last modified: 19Oct2026
+//
+// Returns the next (xorshift) node priority.
+//
+// Returns:     the next node priority
+// Parameters:  <none>
+//
+unsigned int ChainIndex::nextPriority()
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}   // nextPriority()
+
+
+
+//
+// int sizeOf(n) const
+// Last modified: 19Oct2026
+//
+// Returns the size of the subtree rooted at the parameterized node.
+//
+// Returns:     the size of the subtree
+// Parameters:
+//      n       in      the root of the subtree (or CHAIN_NONE)
+//
+int ChainIndex::sizeOf(const int n) const
+{
+    return (n == CHAIN_NONE) ? 0 : nodes[n].size;
+}   // sizeOf(const int) const
+
+
+
+//
+// void update(n)
+// Last modified: 19Oct2026
+//
+// Recomputes the size of the parameterized node
+// and the parent links of its children.
+//
+// Returns:     <none>
+// Parameters:
+//      n       in      the node being updated
+//
+void ChainIndex::update(const int n)
+{
+    nodes[n].size = sizeOf(nodes[n].left) + sizeOf(nodes[n].right) + 1;
+    if (nodes[n].left  != CHAIN_NONE) nodes[nodes[n].left].parent  = n;
+    if (nodes[n].right != CHAIN_NONE) nodes[nodes[n].right].parent = n;
+}   // update(const int)
+
+
+
+//
+// void split(n, k, l, r)
+// Last modified: 19Oct2026
+//
+// Splits the subtree rooted at the parameterized node into its first k
+// nodes (l) and the rest (r).
+//
+// Returns:     <none>
+// Parameters:
+//      n       in      the root of the subtree (or CHAIN_NONE)
+//      k       in      the number of nodes split to the left
+//      l       out     the root of the left part
+//      r       out     the root of the right part
+//
+void ChainIndex::split(const int n, const int k, int &l, int &r)
+{
+    if (n == CHAIN_NONE)
+    {
+        l = r = CHAIN_NONE;
+        return;
+    }
+    if (sizeOf(nodes[n].left) >= k)
+    {
+        split(nodes[n].left, k, l, nodes[n].left);
+        r = n;
+    }
+    else
+    {
+        split(nodes[n].right, k - sizeOf(nodes[n].left) - 1, nodes[n].right, r);
+        l = n;
+    }
+    update(n);
+    if (l != CHAIN_NONE) nodes[l].parent = CHAIN_NONE;
+    if (r != CHAIN_NONE) nodes[r].parent = CHAIN_NONE;
+}   // split(const int, const int, int &, int &)
+
+
+
+//
+// int merge(l, r)
+// Last modified: 19Oct2026
+//
+// Merges the parameterized subtrees (every node of l preceding every
+// node of r), returning the root of the result.
+//
+// Returns:     the root of the merged subtree
+// Parameters:
+//      l       in      the root of the left subtree (or CHAIN_NONE)
+//      r       in      the root of the right subtree (or CHAIN_NONE)
+//
+int ChainIndex::merge(const int l, const int r)
+{
+    if (l == CHAIN_NONE) return r;
+    if (r == CHAIN_NONE) return l;
+    if (nodes[l].priority > nodes[r].priority)
+    {
+        nodes[l].right = merge(nodes[l].right, r);
+        update(l);
+        return l;
+    }
+    nodes[r].left = merge(l, nodes[r].left);
+    update(r);
+    return r;
+}   // merge(const int, const int)
+
+
+
+//
+// bool insertAt(pos, id)
+// Last modified: 19Oct2026
+//
+// Attempts to insert the parameterized cell at the parameterized position,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      pos     in      the position of the cell in the chain
+//      id      in      the ID of the cell being inserted
+//
+bool ChainIndex::insertAt(const int pos, const int id)
+{
+    if ((id < 0) || (contains(id)) || (pos < 0) || (pos > nNodes)) return false;
+    if (id >= (int)nodes.size())
+    {
+        Node empty = {CHAIN_NONE, CHAIN_NONE, CHAIN_NONE, 0, 0, false};
+        nodes.resize(id + 1, empty);
+    }
+    Node n = {CHAIN_NONE, CHAIN_NONE, CHAIN_NONE, 1, nextPriority(), true};
+    nodes[id] = n;
+
+    int l, r;
+    split(root, pos, l, r);
+    root = merge(merge(l, id), r);
+    nodes[root].parent = CHAIN_NONE;
+    ++nNodes;
+    return true;
+}   // insertAt(const int, const int)
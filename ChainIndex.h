@@ -0,0 +1,74 @@
+//
+// Filename:        "ChainIndex.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes an order-statistics index over the
+//                  formation chain (left to right), keyed by cell ID, so
+//                  that splicing, positions, and hop counts are O(log N).
+//
+
+// preprocessor directives
+#ifndef CHAIN_INDEX_H
+#define CHAIN_INDEX_H
+#include <vector>
+using namespace std;
+
+
+
+// chain index definitions
+#define CHAIN_NONE (-1)   // no node (null link)
+
+
+
+// describes an order-statistics index over the formation chain,
+// implemented as an implicit treap with parent links
+class ChainIndex
+{
+    public:
+
+        // <constructors>
+        ChainIndex();
+
+        // <public mutator functions>
+        bool insertFirst(const int id);
+        bool insertAfter(const int nbrID, const int id);
+        bool insertBefore(const int nbrID, const int id);
+        bool remove(const int id);
+        void clear();
+
+        // <public accessor functions>
+        bool contains(const int id)     const;
+        int  getSize()                  const;
+        int  getPosition(const int id)  const;
+        int  getIDAt(const int pos)     const;
+        int  getNLeftOf(const int id)   const;
+        int  getNRightOf(const int id)  const;
+
+    protected:
+
+        // describes a node of the treap
+        struct Node
+        {
+            int          left, right, parent;
+            int          size;
+            unsigned int priority;
+            bool         used;
+        };  // Node
+
+        // <protected data members>
+        vector<Node> nodes;     // indexed by cell ID
+        int          root;
+        int          nNodes;
+        unsigned int rngState;  // own generator, so rand() is unaffected
+
+        // <protected utility functions>
+        unsigned int nextPriority();
+        int          sizeOf(const int n) const;
+        void         update(const int n);
+        void         split(const int n, const int k, int &l, int &r);
+        int          merge(const int l, const int r);
+        bool         insertAt(const int pos, const int id);
+};  // ChainIndex
+
+#endif
@@ -9,6 +9,7 @@
 
 // preprocessor directives
 #include "Circle.h"
+#include "Renderer.h"
 
 
 
@@ -251,60 +252,15 @@ GLfloat Circle::getArea() const
 // void draw()
 // Last modified: 06Nov2009
 //
-// Renders the circle with current vector position and radius.
+// Renders the circle with current vector position and radius
+// (by the current renderer, if any, see Renderer.h).
 //
 // Returns:     <none>
 // Parameters:  <none>
 //
 void Circle::draw()
 {
-    if ((color[GLUT_RED]   == COLOR[INVISIBLE][GLUT_RED])   &&
-        (color[GLUT_GREEN] == COLOR[INVISIBLE][GLUT_GREEN]) &&
-        (color[GLUT_BLUE]  == COLOR[INVISIBLE][GLUT_BLUE])) return;
-    glColor3fv(color);
-    glLineWidth(VECTOR_LINE_WIDTH);
-
-	  // draw vector position
-    if (showPos) Vector::draw();
-
-    // draw a polygonal approximation to the circle
-    glPushMatrix();
-        glRotated(rotate[0], 1, 0, 0);
-        glRotated(rotate[1], 0, 1, 0);
-        glRotated(rotate[2], 0, 0, 1);
-        glTranslated(x + translate[0], y + translate[1], z + translate[2]);
-        glRotated(angle(), 0, 0, 1);
-        glScaled(scale[0], scale[1], scale[2]);
-
-        // draw each edge of the polygonal approximation to the circle
-        GLfloat dx = radius, dy = 0.0f, tx = 0.0f, ty = 0.0f;
-        if (showFilled)
-        {
-            glBegin(GL_TRIANGLE_FAN);
-            glVertex2f(0.0f, 0.0f);    // origin
-        }
-        else glBegin(GL_LINE_LOOP);
-        for (GLint i = 0; i <= CIRCLE_N_LINKS; ++i)
-	      {
-            glVertex2f(dx, dy);    // output vertex
-
-            // calculate the tangential vector;
-            // remember, the radial vector is (x, y);
-            // to get the tangential vector, we flip those coordinates
-            // and negate one of them
-            tx  = -dy;
-            ty  =  dx;
-
-            // add the tangential vector (tan-theta)
-            dx += tx * CIRCLE_TAN_THETA;
-            dy += ty * CIRCLE_TAN_THETA;
-
-            // correct using the radial factor (cos-theta)
-            dx *= CIRCLE_COS_THETA;
-            dy *= CIRCLE_COS_THETA;
-	      }
-        glEnd();
-    glPopMatrix();
+    if (Renderer::current != NULL) Renderer::current->drawCircle(*this);
 }   // draw()
 
 
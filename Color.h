@@ -10,7 +10,7 @@
 // preprocessor directives
 #ifndef COLOR_H
 #define COLOR_H
-#include "GLIncludes.h"
+#include "GLTypes.h"
 
 
 
@@ -27,6 +27,12 @@ enum Color    // color array index values
     BLUE,
     MAGENTA
 };  // Color
+enum ColorComponent    // color array component index values
+{
+    RED_COMPONENT = 0,
+    GREEN_COMPONENT,
+    BLUE_COMPONENT
+};  // ColorComponent
 const GLint   N_COLORS           = 9;    // number of colors
 const GLfloat COLOR[N_COLORS][3] =       // color array
 {
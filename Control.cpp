@@ -0,0 +1,422 @@
+//
+// Filename:        "Control.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the control socket of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <sstream>
+#include "Control.h"
+#include "Environment.h"
+#include "Profiler.h"
+
+
+
+// <static data members>
+bool Control::enabled = false;
+
+
+
+// describes a client of the control socket
+struct ControlClient
+{
+    int    fd;
+    string input;     // received, not yet a complete line
+    string output;    // queued, not yet written
+};  // ControlClient
+
+
+
+// control socket global variables
+static int                   g_listener     = -1;
+static string                g_path         = "";
+static vector<ControlClient> g_clients;
+static double                g_lastMetrics  = 0.0;    // (see Profiler::now())
+static GLint                 g_lastStep     = 0;
+static GLint                 g_lastMessages = 0;
+
+
+
+// <utility functions>
+
+//
+// bool setNonBlocking(fd)
+// Last modified: 19Oct2026
+//
+// Attempts to make the parameterized file descriptor non-blocking,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      fd      in      the file descriptor being changed
+//
+static bool setNonBlocking(const int fd)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    return (flags >= 0) && (fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0);
+}   // setNonBlocking(const int)
+
+
+
+//
+// bool flush(c)
+// Last modified: 19Oct2026
+//
+// Writes as much of the output queued for the parameterized client as it
+// accepts (without blocking), returning true if the client is still
+// connected, false otherwise.
+//
+// Returns:     true if the client is still connected, false otherwise
+// Parameters:
+//      c       in/out  the client being written to
+//
+static bool flush(ControlClient &c)
+{
+    if (c.fd < 0) return false;
+    while (!c.output.empty())
+    {
+        ssize_t n = send(c.fd, c.output.data(), c.output.size(),
+                         MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n > 0) c.output.erase(0, n);
+        else if ((n < 0) && (errno == EINTR)) continue;
+        else return (n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+    }
+    return true;
+}   // flush(ControlClient &)
+
+
+
+//
+// bool receive(c, lines)
+// Last modified: 19Oct2026
+//
+// Reads what the parameterized client has sent (without blocking), adding
+// each complete line to the parameterized lines, returning true if the
+// client is still connected, false otherwise.
+//
+// Returns:     true if the client is still connected, false otherwise
+// Parameters:
+//      c       in/out  the client being read from
+//      lines   out     the lines received
+//
+static bool receive(ControlClient &c, vector<string> &lines)
+{
+    char buffer[CONTROL_MAX_LINE];
+    while (true)
+    {
+        ssize_t n = recv(c.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (n > 0) c.input.append(buffer, n);
+        else if ((n < 0) && (errno == EINTR)) continue;
+        else if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+            break;
+        else return false;
+    }
+    size_t end;
+    while ((end = c.input.find('\n')) != string::npos)
+    {
+        lines.push_back(c.input.substr(0, end));
+        c.input.erase(0, end + 1);
+    }
+    if (c.input.size() > CONTROL_MAX_LINE) c.input.clear();    // garbage
+    return true;
+}   // receive(ControlClient &, vector<string> &)
+
+
+
+// <public static mutator functions>
+
+//
+// bool open(path)
+// Last modified: 19Oct2026
+//
+// Attempts to listen (without blocking) on a Unix-domain socket at the
+// parameterized path (replacing any stale socket there), returning true
+// if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      path    in      the path of the socket
+//
+bool Control::open(const string &path)
+{
+    if (enabled) close();
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    strcpy(addr.sun_path, path.c_str());
+
+    g_listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (g_listener < 0) return false;
+    unlink(path.c_str());
+    if ((bind(g_listener, (sockaddr *)&addr, sizeof(addr)) != 0) ||
+        (listen(g_listener, CONTROL_MAX_CLIENTS) != 0)           ||
+        (!setNonBlocking(g_listener)))
+    {
+        ::close(g_listener);
+        g_listener = -1;
+        return false;
+    }
+    g_path         = path;
+    g_lastMetrics  = Profiler::now();
+    g_lastStep     = 0;
+    g_lastMessages = 0;
+    enabled        = true;
+    return true;
+}   // open(const string &)
+
+
+
+//
+// bool close()
+// Last modified: 19Oct2026
+//
+// Attempts to stop listening, disconnecting the clients (after writing
+// what they accept of their queued output), returning true if successful,
+// false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Control::close()
+{
+    if (!enabled) return false;
+    enabled = false;
+    for (size_t i = 0; i < g_clients.size(); ++i)
+    {
+        if (g_clients[i].fd < 0) continue;
+        flush(g_clients[i]);
+        ::close(g_clients[i].fd);
+    }
+    g_clients.clear();
+    bool success = ::close(g_listener) == 0;
+    g_listener   = -1;
+    unlink(g_path.c_str());
+    return success;
+}   // close()
+
+
+
+//
+// void poll(env, commands, timeout)
+// Last modified: 19Oct2026
+//
+// Accepts new clients, adds the commands they have sent to the
+// parameterized commands (as errors, those it cannot parse), writes
+// their queued output, and sends them the metrics of the parameterized
+// environment if due, waiting for a client at most the parameterized
+// time (0 = not at all).
+//
+// Returns:     <none>
+// Parameters:
+//      env         in      the environment being measured
+//      commands    out     the commands received
+//      timeout     in      the time to wait for a client (in ms)
+//
+void Control::poll(Environment            *env,
+                   vector<ControlCommand> &commands,
+                   const GLint             timeout)
+{
+    if (!enabled) return;
+
+    // drop the clients disconnected at the last poll
+    for (size_t i = 0; i < g_clients.size(); )
+    {
+        if (g_clients[i].fd >= 0) ++i;
+        else g_clients.erase(g_clients.begin() + i);
+    }
+
+    // wait for a client (e.g., while paused)
+    if (timeout > 0)
+    {
+        vector<pollfd> fds(1);
+        fds[0].fd     = g_listener;
+        fds[0].events = POLLIN;
+        for (size_t i = 0; i < g_clients.size(); ++i)
+        {
+            pollfd p = {g_clients[i].fd, POLLIN, 0};
+            if (!g_clients[i].output.empty()) p.events |= POLLOUT;
+            fds.push_back(p);
+        }
+        ::poll(&fds[0], fds.size(), timeout);
+    }
+
+    // accept new clients
+    int fd;
+    while ((fd = accept(g_listener, NULL, NULL)) >= 0)
+    {
+        if ((g_clients.size() >= CONTROL_MAX_CLIENTS) ||
+            (!setNonBlocking(fd)))
+        {
+            ::close(fd);
+            continue;
+        }
+        ControlClient c;
+        c.fd = fd;
+        g_clients.push_back(c);
+    }
+
+    // receive commands
+    for (size_t i = 0; i < g_clients.size(); ++i)
+    {
+        vector<string> lines;
+        bool           connected = receive(g_clients[i], lines);
+        for (size_t j = 0; j < lines.size(); ++j)
+        {
+            ControlCommand command;
+            if (!parse(lines[j], command))
+            {
+                if (lines[j].find_first_not_of(" \t\r") == string::npos)
+                    continue;
+                command.type = CONTROL_ERROR;
+                command.line = lines[j];
+            }
+            command.client = i;
+            commands.push_back(command);
+        }
+        if (!connected)
+        {
+            ::close(g_clients[i].fd);
+            g_clients[i].fd = -1;
+            g_clients[i].output.clear();
+        }
+    }
+
+    // send the metrics if due
+    if (Profiler::now() - g_lastMetrics >= CONTROL_METRICS_INTERVAL / 1000.0)
+        sendMetrics(env);
+
+    // write queued output, closing disconnected clients (dropped at the
+    // next poll, so that the commands received refer to their clients)
+    for (size_t i = 0; i < g_clients.size(); ++i)
+    {
+        if ((g_clients[i].fd < 0) || (flush(g_clients[i]))) continue;
+        ::close(g_clients[i].fd);
+        g_clients[i].fd = -1;
+        g_clients[i].output.clear();
+    }
+}   // poll(Environment *, vector<ControlCommand> &, const GLint)
+
+
+
+//
+// void reply(client, line)
+// Last modified: 19Oct2026
+//
+// Queues the parameterized line for the parameterized client
+// (written by the next poll), unless it has more than CONTROL_MAX_OUTPUT
+// bytes unread.
+//
+// Returns:     <none>
+// Parameters:
+//      client  in      the client being replied to
+//      line    in      the line being queued
+//
+void Control::reply(const GLint client, const string &line)
+{
+    if ((!enabled) || (client < 0) || (client >= (GLint)g_clients.size()) ||
+        (g_clients[client].fd < 0) ||
+        (g_clients[client].output.size() > CONTROL_MAX_OUTPUT)) return;
+    g_clients[client].output += line;
+    g_clients[client].output += '\n';
+    flush(g_clients[client]);
+}   // reply(const GLint, const string &)
+
+
+
+//
+// void sendMetrics(env, client)
+// Last modified: 19Oct2026
+//
+// Queues the metrics of the parameterized environment since they were
+// last sent for the parameterized client (-1 = every client).
+//
+// Returns:     <none>
+// Parameters:
+//      env     in      the environment being measured
+//      client  in      the client being sent to (-1 = every client)
+//
+void Control::sendMetrics(Environment *env, const GLint client)
+{
+    if ((!enabled) || (env == NULL)) return;
+    double now      = Profiler::now();
+    GLint  steps    = env->stepCount - g_lastStep;
+    GLint  messages = env->getNMessages() - g_lastMessages;
+    char   line[CONTROL_MAX_LINE];
+    snprintf(line, sizeof(line),
+             "metrics step=%d rate=%.1f cells=%d free=%d error=%g"
+             " messages=%.1f",
+             env->stepCount,
+             (now > g_lastMetrics) ? steps / (now - g_lastMetrics) : 0.0,
+             env->getNCells(), env->getNFreeRobots(), env->getError(),
+             (steps > 0) ? (double)messages / steps : 0.0);
+    if (client >= 0) reply(client, line);
+    else for (size_t i = 0; i < g_clients.size(); ++i) reply(i, line);
+    g_lastMetrics  = now;
+    g_lastStep     = env->stepCount;
+    g_lastMessages = env->getNMessages();
+}   // sendMetrics(Environment *, const GLint)
+
+
+
+// <protected static utility functions>
+
+//
+// bool parse(line, command)
+// Last modified: 19Oct2026
+//
+// Attempts to parse the parameterized line as a command,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      line        in      the line being parsed
+//      command     out     the command parsed
+//
+bool Control::parse(const string &line, ControlCommand &command)
+{
+    static const struct
+    {
+        const char *name;
+        ControlType type;
+        bool        hasValue;
+    } COMMANDS[] = {{"formation", CONTROL_FORMATION, true},
+                    {"heading",   CONTROL_HEADING,   true},
+                    {"radius",    CONTROL_RADIUS,    true},
+                    {"seed",      CONTROL_SEED,      true},
+                    {"pause",     CONTROL_PAUSE,     false},
+                    {"resume",    CONTROL_RESUME,    false},
+                    {"step",      CONTROL_STEP,      true},
+                    {"snapshot",  CONTROL_SNAPSHOT,  false},
+                    {"metrics",   CONTROL_METRICS,   false},
+                    {"quit",      CONTROL_QUIT,      false}};
+    istringstream is(line);
+    string        name;
+    if (!(is >> name)) return false;
+    for (size_t i = 0; i < sizeof(COMMANDS) / sizeof(COMMANDS[0]); ++i)
+    {
+        if (name != COMMANDS[i].name) continue;
+        command.type  = COMMANDS[i].type;
+        if ((is >> command.value).fail())
+        {
+            if ((COMMANDS[i].hasValue) && (command.type != CONTROL_STEP))
+                return false;
+            command.value = 1.0f;    // (i.e., step 1)
+            is.clear();
+        }
+        string extra;
+        return !(is >> extra);
+    }
+    return false;
+}   // parse(const string &, ControlCommand &)
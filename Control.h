@@ -0,0 +1,104 @@
+//
+// Filename:        "Control.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the control socket of the
+//                  simulation, a Unix-domain socket through which local
+//                  clients (e.g., "socat - UNIX-CONNECT:<socket>") monitor
+//                  and drive a headless run.  The socket is polled by the
+//                  simulation between steps without blocking: clients are
+//                  accepted and read as they become ready, replies are
+//                  queued and written as the clients accept them, and
+//                  every CONTROL_METRICS_INTERVAL ms each client is sent
+//
+//                      metrics step=<s> rate=<steps/s> cells=<n>
+//                              free=<n> error=<sum> messages=<per step>
+//
+//                  (replies are dropped for a client that has more than
+//                  CONTROL_MAX_OUTPUT bytes unread).  Commands are lines of
+//                  a name and an optional value, replied to in order:
+//
+//                      formation <index>   heading <degrees>
+//                      radius <radius>     seed <id>
+//                      pause               resume
+//                      step <n>            snapshot
+//                      metrics             quit
+//
+
+// preprocessor directives
+#ifndef CONTROL_H
+#define CONTROL_H
+#include <string>
+#include <vector>
+#include "GLTypes.h"
+using namespace std;
+
+
+
+// control socket settings
+#define CONTROL_MAX_CLIENTS        (8)
+#define CONTROL_MAX_LINE           (256)        // bytes of a command
+#define CONTROL_MAX_OUTPUT         (1 << 22)    // bytes queued per client
+#define CONTROL_METRICS_INTERVAL   (500)        // ms between metrics
+
+
+
+// enumerated control command types
+enum ControlType
+{
+    CONTROL_FORMATION = 0,    // change to the formation <index>
+    CONTROL_HEADING,          // change the formation heading
+    CONTROL_RADIUS,           // change the formation radius
+    CONTROL_SEED,             // select the seed of the next formation
+    CONTROL_PAUSE,            // stop stepping
+    CONTROL_RESUME,           // start stepping
+    CONTROL_STEP,             // step <n> times (while paused)
+    CONTROL_SNAPSHOT,         // reply with the trajectory of the step
+    CONTROL_METRICS,          // reply with the metrics now
+    CONTROL_QUIT,             // finish the run
+    CONTROL_ERROR             // reply with an error (to an unknown line)
+};  // ControlType
+
+
+
+// describes a command received through the control socket
+struct ControlCommand
+{
+    ControlType type;
+    GLfloat     value;     // (of formation, heading, radius, seed, step)
+    GLint       client;    // the client to reply to
+    string      line;      // (of an error) the line received
+};  // ControlCommand
+
+
+
+// forward declaration of a robot cell environment
+class Environment;
+
+
+
+// describes the (process-wide) control socket
+class Control
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static bool open(const string &path);
+        static bool close();
+        static void poll(Environment            *env,
+                         vector<ControlCommand> &commands,
+                         const GLint             timeout = 0);
+        static void reply(const GLint client, const string &line);
+        static void sendMetrics(Environment *env, const GLint client = -1);
+
+    protected:
+
+        // <protected static utility functions>
+        static bool parse(const string &line, ControlCommand &command);
+};  // Control
+
+#endif
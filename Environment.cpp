@@ -9,6 +9,8 @@
 
 // preprocessor directives
 #include "Environment.h"
+#include "AuctionPolicy.h"
+#include "StateRing.h"
 
 
 
@@ -27,17 +29,21 @@
 //      n           in      the initial number of cells
 //      f           in      the initial formation
 //      colorIndex  in      the initial array index of the color of the cells
+//      seed        in      the seed of rand() (0 = the time, see init())
 //
 Environment::Environment(const GLint     n,
                          const Formation f,
                          const Color     colorIndex,
                          const int       insert,
                          const float     max_t_error,
-                         string          randInput)
+                         string          randInput,
+                         string          policy,
+                         const unsigned int seed)
 {
     //string s = randInput;
     inputFile = randInput;
-    if (!init(n, f, colorIndex, insert,max_t_error)) clear();
+    robotPool = NULL;
+    if (!init(n, f, colorIndex, insert,max_t_error,policy,seed)) clear();
 }   // Environment(const GLint, const Formation, const Color)
 
 
@@ -54,7 +60,8 @@ Environment::Environment(const GLint     n,
 //      e       in/out      the environment being copied
 //
 Environment::Environment(const Environment &e)
-    : cells(e.cells), msgQueue(e.msgQueue)
+    : cells(e.cells), cellsByID(e.cellsByID), chain(e.chain),
+      msgQueue(e.msgQueue), robotPool(NULL), auctionPolicy(e.auctionPolicy)
 {
 }   // Environment(const Environment &)
 
@@ -74,6 +81,7 @@ Environment::Environment(const Environment &e)
 Environment::~Environment()
 {
     clear();
+    delete [] robotPool;
 }   // ~Environment()
 
 
@@ -95,9 +103,9 @@ Environment::~Environment()
 //
 bool Environment::setColor(const GLfloat r, const GLfloat g, const GLfloat b)
 {
-    color[GLUT_RED]   = r;
-    color[GLUT_GREEN] = g;
-    color[GLUT_BLUE]  = b;
+    color[RED_COMPONENT]   = r;
+    color[GREEN_COMPONENT] = g;
+    color[BLUE_COMPONENT]  = b;
     return true;
 }   // setColor(const GLfloat, const GLfloat, const GLfloat)
 
@@ -116,7 +124,7 @@ bool Environment::setColor(const GLfloat r, const GLfloat g, const GLfloat b)
 //
 bool Environment::setColor(const GLfloat clr[3])
 {
-    return setColor(clr[GLUT_RED], clr[GLUT_GREEN], clr[GLUT_BLUE]);
+    return setColor(clr[RED_COMPONENT], clr[GREEN_COMPONENT], clr[BLUE_COMPONENT]);
 }   // setColor(const GLfloat [])
 
 
@@ -162,12 +170,19 @@ bool Environment::addCell(Cell *c)
     bool done = true;
     c->setEnvironment(this);
     c->getState().formation.setFormationID(formation.getFormationID());
-    cout << " new cell " << c->getID() << " has a formation ID = " << c->getState().formation.getFormationID() << endl;
+    LOG(LOG_DEBUG, LOG_FORMATION, "new cell %d has a formation ID = %d",
+        c->getID(), c->getState().formation.getFormationID());
     c->insertion = insertion;
     c->max_trans_error = max_trans_error;
 
-    // attempt to add this cell to the cell list
+    // attempt to add this cell to the cell list (and index it by ID)
 	cells.push_back(c);
+    if (c->getID() >= 0)
+    {
+        if (c->getID() >= (GLint)cellsByID.size())
+            cellsByID.resize(c->getID() + 1, NULL);
+        cellsByID[c->getID()] = c;
+    }
     return true;
 }   // addCell(Cell *)
 
@@ -217,6 +232,9 @@ bool Environment::removeCell(Cell* c)
 		if(c==cells[i])
 		{
 			cells.erase(cells.begin()+i);
+			chain.remove(c->getID());
+			if ((c->getID() >= 0) && (c->getID() < (GLint)cellsByID.size()))
+				cellsByID[c->getID()] = NULL;
 			answer = true;
 			break;
 		}
@@ -230,29 +248,40 @@ bool Environment::removeCell(Cell* c)
 
 //
 // Cell* getCell() const
-// Last modified: 27Aug2006
+// Last modified: 19Oct2026
 //
-// Returns the cell at the parameterized position.
+// Returns the cell with the parameterized ID.
 //
-// Returns:     the cell at the parameterized position
-// Parameters:  <none>
+// Returns:     the cell with the parameterized ID (or NULL)
+// Parameters:
+//      pos     in      the ID of the cell
 //
 Cell* Environment::getCell(GLint pos) const
 {
-	Cell *c = NULL;
-	for(GLint i=0;i< cells.size();i++)
-	{
-		if(pos==cells[i]->getID())
-		{
-			c = cells[i];
-			break;
-		}
-	}
-	return c;
+	if ((pos < 0) || (pos >= (GLint)cellsByID.size())) return NULL;
+	return cellsByID[pos];
 }   // getCell(GLint) const
 
 
 
+//
+// Cell* getCellAt(pos) const
+// Last modified: 19Oct2026
+//
+// Returns the cell at the parameterized position
+// (from the left end of the formation chain, starting at 0).
+//
+// Returns:     the cell at the parameterized position (or NULL)
+// Parameters:
+//      pos     in      the position in the formation chain
+//
+Cell* Environment::getCellAt(const GLint pos) const
+{
+	return getCell(chain.getIDAt(pos));
+}   // getCellAt(const GLint) const
+
+
+
 //
 // vector<Cell *> getCells()
 // Last modified: 27Aug2006
@@ -317,6 +346,39 @@ GLint Environment::getNFreeRobots() const
 
 
 
+//
+// GLint getNMessages() const
+// Last modified: 19Oct2026
+//
+// Returns the number of messages sent in the environment.
+//
+// Returns:     the number of messages sent in the environment
+// Parameters:  <none>
+//
+GLint Environment::getNMessages() const
+{
+    return totalMessages;
+}   // getNMessages() const
+
+
+
+//
+// GLfloat getError() const
+// Last modified: 19Oct2026
+//
+// Returns the sum of the translational errors of the cells
+// at the last step (see gatherError()).
+//
+// Returns:     the sum of the translational errors of the cells
+// Parameters:  <none>
+//
+GLfloat Environment::getError() const
+{
+    return errorSum.empty() ? 0.0f : errorSum.back().trans;
+}   // getError() const
+
+
+
 // <virtual public utility functions>
 
 //
@@ -351,6 +413,82 @@ void Environment::draw()
 
 
 
+//
+// void capture(s)
+// Last modified: 19Oct2026
+//
+// Captures what is rendered of the environment (as drawn by draw())
+// into the parameterized snapshot, reusing its storage.
+//
+// Returns:     <none>
+// Parameters:
+//      s       in/out  the snapshot captured into
+//
+void Environment::capture(Snapshot &s)
+{
+    if (cells.size() > 0) getCell(formation.getSeedID())->setColor(GREEN);
+    s.stepCount = stepCount;
+    for (GLint i = 0; i < 3; ++i) s.color[i] = color[i];
+    s.robots.clear();
+    s.robots.reserve(cells.size() + robots.size());
+    for (size_t i = 0; i < cells.size(); ++i)
+        s.robots.push_back(RobotSnapshot(*cells[i]));
+    for (size_t i = 0; i < robots.size(); ++i)
+        s.robots.push_back(RobotSnapshot(*robots[i]));
+}   // capture(Snapshot &)
+
+
+
+//
+// GLint exportState(entities, maxEntities) const
+// Last modified: 19Oct2026
+//
+// Writes the state of each cell, then each [free] robot, to the
+// parameterized entities (see StateRing.h), returning the number written.
+//
+// Returns:     the number of entities written
+// Parameters:
+//      entities    out     the entities being written
+//      maxEntities in      the number of entities that fit
+//
+GLint Environment::exportState(RingEntity *entities,
+                               const GLint maxEntities) const
+{
+    GLint n = 0;
+    for (size_t i = 0; (i < cells.size()) && (n < maxEntities); ++i, ++n)
+    {
+        const Cell *c = cells[i];
+        RingEntity &e = entities[n];
+        e.x        = c->x;
+        e.y        = c->y;
+        e.heading  = c->getHeading();
+        e.radius   = c->getRadius();
+        e.id       = c->getID();
+        e.leftNbr  = (c->leftNbr  != NULL) ? c->leftNbr->ID  : RING_NO_NBR;
+        e.rightNbr = (c->rightNbr != NULL) ? c->rightNbr->ID : RING_NO_NBR;
+        e.flags    = RING_CELL;
+        if (c->getID() == formation.getSeedID()) e.flags |= RING_SEED;
+        if (c->showHeading)                      e.flags |= RING_SHOW_HEADING;
+        e.color    = packColor(c->color);
+    }
+    for (size_t i = 0; (i < robots.size()) && (n < maxEntities); ++i, ++n)
+    {
+        const Robot *r = robots[i];
+        RingEntity  &e = entities[n];
+        e.x        = r->x;
+        e.y        = r->y;
+        e.heading  = r->getHeading();
+        e.radius   = r->getRadius();
+        e.id       = r->getID();
+        e.leftNbr  = e.rightNbr = RING_NO_NBR;
+        e.flags    = r->showHeading ? RING_SHOW_HEADING : 0;
+        e.color    = packColor(r->color);
+    }
+    return n;
+}   // exportState(RingEntity *, const GLint) const
+
+
+
 //
 // void step()
 // Last modified: 27Aug2006
@@ -363,149 +501,50 @@ void Environment::draw()
 //
 bool Environment::step()
 {
-    if(startFormation)
-    {
-        if(insertion)
-        {
+    ProfileTimer stepTimer;
 
-            //vector<Robot*> auctionCalls;
-            //Robot *auctionCall = NULL;
-            for(GLint i = 0; i < robots.size(); ++i)
-            {
-                //auctionCall =
-                if(robots[i]->auctioningStep()!=NULL)
-                {
-                    //auctionCalls.push_back(auctionCall);
-                    Robot* a = robots[i];
-                    Formation f = formation;
-                    Insertion_Auction_Announcement* aa = new Insertion_Auction_Announcement(a->getID());
-                    sendMsg((Message)aa, ID_BROADCAST, a->getID(), INSERTION_AUCTION_ANNOUNCEMENT);
-                    a->setAuctionStepCount(1);
-                }
-            }
-            //cout << "done stepping cells" << endl;
-            //forwardPackets();
-            /*for(int i=0; i<auctionCalls.size();i++)
-            {
+    // deliver the packets sent during the last step (discrete message passing)
+    if(!msgQueue.empty())
+    {
+        ProfileTimer timer(PHASE_DELIVER);
+        forwardPackets();
+    }
 
-            }*/
-
-            //forwardPackets();
-            for(int i=0;i<cells.size();i++)
-            {
-                cells[i]->cStep();
-            }
-
-            //forwardPackets();
-            //cout << "after forwardPackets " << endl;
-            //auctionCalls.clear();
-            //cout << " after auctionCalls.clear() " << endl;
-            bool auctionSettled = false;
-            for(int i=0; i<robots.size(); i++)
-            {
-                //cout << "hitting robot["<<robots[i]->getID()<<"]"<<endl;
-                //if(robots[i]->getAuctionStepCount() >= AUCTION_STEP_COUNT)
-                //{
-                robots[i]->processPackets();
-                //cout << "robot processSaucePacketsess" << endl;
-                if(!auctionSettled)
-                {
-                    auctionSettled = robots[i]->settleAuction();
-                    //if(auctionSettled) cout << "settled an auction..." << endl;
-                }
-                robots[i]->bids.clear();
-                //}
-            }
-
-            //cout << "done with env->step()" << endl;
-            for(int i=0;i<cells.size();i++)
-            {
-                cells[i]->outstandingBid = 0;
-            }
-        } else { //Push Auctioning
-            //vector<Cell*> auctionCalls;
-            //Cell *auctionCall = NULL;
-            vector<int> cells_with_auctions;
-            for (GLint i = 0; i < getNCells(); ++i)
-            {
-                if(cells[i]->cStep())
-                //if(cells[i]->getNNbrs() < NEIGHBORHOOD_SIZE)
-                {
-                    //if(cells[i]->cStep())
-                    //{
-                    Cell* a = cells[i];
-                    cells_with_auctions.push_back(i);
-                    auctions.push(a);
-                    State s = a->getState() ;
-                    Formation f = formation;
-                    bool dir;
-                    if (a->rightNbr == NULL)
-                    {
-                        dir = true;
-                    } else {
-                        dir = false;
-                    }
-                    Push_Auction_Announcement* aa = new Push_Auction_Announcement(a->getState().gradient, s, dir);
-                    sendMsg((Message)aa, ID_BROADCAST, a->getID(), PUSH_AUCTION_ANNOUNCEMENT);
-                    a->setAuctionStepCount(1);
-                    //}
-                }
-            }
-
-            for(int i=0;i<robots.size();i++)
-            {
-                robots[i]->processPackets();
-                robots[i]->step();
-            }
-            //forwardPackets();
-            //auctionCalls.clear();
-
-            /*
-            cout << "contents of cells_with_auctions:" << endl;
-            for(int i=0;i<cells_with_auctions.size();i++)
-            {
-                int q = cells_with_auctions[i];
-                cout << q << endl;
-                //cells[q]->settleAuction();
-            }
-            for(int i=0; i<getNCells(); i++)
-            {
-                if(cells[i]->getAuctionStepCount() >= AUCTION_STEP_COUNT)
-                {
-                    cells[i]->settleAuction();
-                }
-            }
-            /*
-            cout << "contents of cells_with_auctions:" << endl;
-            for(int i=0;i<cells_with_auctions.size();i++)
-            {
-                int q = cells_with_auctions[i];
-                cout << q << endl;
-                cells[q]->settleAuction();
-            }
-            */
-            int s = auctions.size();
-            for(int i=0;i<s;i++)
-            {
-                if(auctions.front()->getAuctionStepCount() >= AUCTION_STEP_COUNT)
-                {
-                    auctions.front()->settleAuction();
-                    auctions.pop();
-                }else{
-                    Cell * c = auctions.front();
-                    auctions.pop();
-                    auctions.push(c);
-                }
-            }
-        }
-	}
+    // run the step kernel of the auction policy (see AuctionPolicy.h)
+    if(startFormation) auctionPolicy->step(*this);
+
+    // send the states of the cells once every cell has moved (discrete
+    // message passing; delivered at the start of the next step)
+    if((startFormation) && (discrete))
+    {
+        ProfileTimer timer(PHASE_DELIVER);
+        sendCellStates();
+    }
+
+    // trace the free robots and the messages still queued
+    if(Trace::enabled)
+    {
+        long nQueued = msgQueue.size();
+        for (GLint i = 0; i < getNCells(); ++i)   nQueued += cells[i]->msgQueue.size();
+        for (GLint i = 0; i < robots.size(); ++i) nQueued += robots[i]->msgQueue.size();
+        Trace::counter("free robots", robots.size());
+        Trace::counter("queued messages", nQueued);
+    }
 
-    gatherMessages();
-    gatherDistances();
-    gatherError();
+    {
+        ProfileTimer timer(PHASE_GATHER);
+        gatherMessages();
+        gatherDistances();
+        gatherError();
+    }
     stepCount++;
 
-    if(quiescence())
+    bool quiet;
+    {
+        ProfileTimer timer(PHASE_QUIESCENCE);
+        quiet = quiescence();
+    }
+    if(quiet)
     {
         return false;
     }
@@ -602,30 +641,23 @@ bool Environment::sendMsg(const Message &msg,
 //removed const
 bool Environment::sendPacket(const Packet &p)
 {
-
-    // discrete message passing
-    //if (msgQueue.enqueue(p)) return true;
+    Profiler::countPacket(p.type);
+
+    // discrete message passing (packets addressed to a cell or robot are
+    // delivered at the start of the next step, see forwardPackets(); an
+    // auction round, i.e., the broadcast announcements and the bids of the
+    // batched bid phases, is still exchanged within the step)
+    if ((discrete) && (p.type != BID) &&
+        (p.toID != ID_BROADCAST) && (p.toID != ID_OPERATOR))
+    {
+        msgQueue.push_back(p);
+        return true;
+    }
 
     // continuous message passing
 	//if(p.type==AUCTION_ANNOUNCEMENT)printf("auctionannouncement in sendPacket()\n");
     if (forwardPacket(p)) return true;
-	//if(VERBOSE)printf("just before delete p.msg;\n");
-	//(cast as message type -- delete (state *)
-	if(p.msg != NULL)
-	{
-		if(p.type==STATE)
-		{
-			//if(VERBOSE) printf("attempting to delete STATE message\n");
-			delete (State *)p.msg;
-			//if(VERBOSE) printf("successfully deleted STATE message\n");
-		}else if(p.type==CHANGE_FORMATION)
-		{
-			//if(VERBOSE) printf("attempting to delete CHANGE_FORMATION message\n");
-			delete (Formation *)p.msg;
-		}
-	}
-	//p.msg = NULL;
-	if(VERBOSE) printf("finished sendPacket()\n");
+	LOG(LOG_TRACE, LOG_ENV, "finished sendPacket()");
     return false;
 }   // sendPacket(const Packet &)
 
@@ -634,7 +666,8 @@ bool Environment::sendPacket(const Packet &p)
 // Last modified: 29Nov2009
 //
 // Attempts to forward a packet to its destination,
-// returning true if successful, false otherwise.
+// returning true if successful, false otherwise
+// (the message of a packet that cannot be delivered is deleted here).
 //
 // Returns:     true if successful, false otherwise
 // Parameters:
@@ -649,7 +682,7 @@ bool Environment::forwardPacket(const Packet &p)
     if(p.toID < ID_BROADCAST)
     {
         //cout << "Forwarding a packet to robot["<<p.toID<<"] from "<< p.fromID << endl;
-        Robot *r;
+        Robot *r = NULL;
         if(!p.fromBroadcast())
         {
             r = getRobot(p.toID);
@@ -657,16 +690,18 @@ bool Environment::forwardPacket(const Packet &p)
         if(r !=NULL)
         {
             //cout << "not nullsy for robot id = "<<r->getID() << endl;
-            r->msgQueue.push(p);
+            if (!r->msgQueue.push(p)) ++mailboxOverflows;
+            mailboxPeak = max(mailboxPeak, (GLint)r->msgQueue.size());
             //cout << "finished sending packet to robot" << endl;
             return true;
         }else{
             //cout << "could not locate robot["<<p.toID<<"]"<< endl;
+            deleteMessage(p);
             return false;
         }
 
     }
-    Cell *c;
+    Cell *c = NULL;
 	if((!p.fromBroadcast()) &&(p.toID!=ID_OPERATOR))
 	{
 	    //cout << "sending a message directly to cell cell["<< p.toID << "]." << endl;
@@ -675,7 +710,21 @@ bool Environment::forwardPacket(const Packet &p)
 	int to = p.toID;
     if (c != NULL)
     {
-        c->msgQueue.push(p);
+        // coalesce a state or formation change with the one it supersedes,
+        // found by its sender and type (the formation of a change is not
+        // owned by its packet)
+        bool      keyed = (p.type == STATE) || (p.type == CHANGE_FORMATION);
+        long long key   = (long long)p.fromID * N_MESSAGE_TYPES + p.type;
+        Packet    old;
+        if ((keyed) && (c->msgQueue.replace(p, key, supersedes, old)))
+        {
+            if (old.type == STATE) deleteMessage(old);
+            ++coalescedPackets;
+            return true;
+        }
+        if (!((keyed) ? c->msgQueue.push(p, key) : c->msgQueue.push(p)))
+            ++mailboxOverflows;
+        mailboxPeak = max(mailboxPeak, (GLint)c->msgQueue.size());
         return true;
     }
 	//if (c == NULL) printf("CELL is NULL!\n");
@@ -683,30 +732,25 @@ bool Environment::forwardPacket(const Packet &p)
 	//if(p.msg != NULL) delete p.msg;
 	if(p.msg != NULL)
 	{
-		if(p.type==STATE)
-		{
-			delete (State *)p.msg;
-		}else if(p.type==CHANGE_FORMATION)
+		if((p.type==STATE) || (p.type==CHANGE_FORMATION))
 		{
-			delete (Formation *)p.msg;
+			deleteMessage(p);
 		}else if(p.type == PUSH_AUCTION_ANNOUNCEMENT)
 		{
 			//Robot* r;
 			//cout << "Sending PUSH_AUCTION_ANNOUNCEMENT" << endl;
-			for(int i=0;i<robots.size();i++)
-			{
-				robots[i]->msgQueue.push(p);
-			}
+			// every robot hears the announcement; the robots bid on the
+			// announcements of the step in one batch (bidOnPushAuctions())
+			pushAnnouncements.push_back(p);
 		}else if(p.type == INSERTION_AUCTION_ANNOUNCEMENT)
 		{
-            for(int i=0;i<cells.size();i++)
-            {
-                cells[i]->msgQueue.push(p);
-            }
+            // every cell hears the announcement; the cells bid on the
+            // announcements of the step in one batch (bidOnInsertionAuctions())
+            insertionAnnouncements.push_back(p);
 		}
 
 	}
-	if(VERBOSE) printf("finished forwarding Packet to %d\n",to);
+	LOG(LOG_TRACE, LOG_ENV, "finished forwarding Packet to %d",to);
     return false;
 }   // forwardPacket(const Packet &)
 
@@ -714,24 +758,25 @@ bool Environment::forwardPacket(const Packet &p)
 
 //
 // bool forwardPackets()
-// Last modified: 29Nov2009
+// Last modified: 19Oct2026
 //
-// Attempts to forward all packets to their destinations,
-// returning true if successful, false otherwise.
+// Attempts to forward all packets queued by discrete message passing to
+// their destinations (in the order they were sent; forwardPacket() deletes
+// the messages of those that cannot be delivered), returning true if
+// successful, false otherwise.
 //
 // Returns:     true if successful, false otherwise
 // Parameters:  <none>
 //
 bool Environment::forwardPackets()
 {
-    Packet p;
-    while (!msgQueue.empty())
+    bool success = true;
+    for (size_t i = 0; i < msgQueue.size(); ++i)
     {
-        p = msgQueue.front();
-        msgQueue.pop();
-        if (!forwardPacket(p)) return false;
+        if (!forwardPacket(msgQueue[i])) success = false;
     }
-    return true;
+    msgQueue.clear();
+    return success;
 }   // forwardPackets()
 
 
@@ -840,14 +885,20 @@ bool Environment::showHeading(const bool show)
 //      n           in      the initial number of robots
 //      f           in      the initial formation
 //      colorIndex  in      the initial array index of the color of the cells
+//      seed        in      the seed of rand(), making the run reproducible
+//                          (0 = the time, i.e., a different run each time)
 //
 bool Environment::init(const GLint     n,
                        const Formation f,
                        const Color     colorIndex,
                        const int       insert,
-                       const float     max_t_error)
+                       const float     max_t_error,
+                       const string    policy,
+                       const unsigned int seed)
 {
-    srand(time(NULL));
+    randomSeed = (seed != 0) ? seed : (unsigned int)time(NULL);
+    srand(randomSeed);
+    cout << "random seed = " << randomSeed << endl;
 
     nRobots      = n;
     formation    = f;
@@ -856,65 +907,79 @@ bool Environment::init(const GLint     n,
     stepCount = 0;
     qCount = 0;
     defaultColor = colorIndex;
-    insertion = insert;
     max_trans_error = max_t_error;
+
+    // choose the auction policy (by default, push or insertion)
+    auctionPolicy = findAuctionPolicy(policy);
+    if ((auctionPolicy == NULL) && (!policy.empty()))
+        cout << "unknown auction policy '" << policy << "'" << endl;
+    if (auctionPolicy == NULL)
+        auctionPolicy = findAuctionPolicy(insert ? "insertion" : "push");
+    insertion = auctionPolicy->insertion;
 
-    //char * name = "input.txt";
-    //strncpy(name,inputFile,9);
-    //inputFile[9]='\0';
-    ifstream inp;
-    inp.open(inputFile.c_str());
-    for(int i=0;i<(nRobots*2);i++)
-    {
-        float loc;
-        inp >> loc;
-        initLocs.push(loc);
-    }
-    cout << "initLocs.size() = " << initLocs.size() << endl;
-    inp.close();
+    // memory-map the seed positions (binary or text format)
+    if (!seeds.open(inputFile))
+        cout << "unable to open seed file '" << inputFile << "'" << endl;
+    cout << "seed positions = " << seeds.getNPositions() << endl;
 
-    if(insertion){
-        printf("\n\nUsing Insertion Auction Algorithm\n\n");
-    }
+    printf("\n\nUsing %s Algorithm\n\n", auctionPolicy->title);
     totalMessages = 0;
+    totalAnnouncements = avoidedAnnouncements = 0;
+    avoidedDeliveries  = 0;
+    discrete           = false;
+    mailboxOverflows   = 0;
+    mailboxPeak        = 0;
+    coalescedPackets   = 0;
     bool result = true;
     startFormation = false;
     //initCells(n, f);
     //system("PAUSE");
     initRobots();
 
-    if (VERBOSE) printf("finished initCells()\n");
+    LOG(LOG_TRACE, LOG_ENV, "finished initCells()");
     return result && setColor(colorIndex);
 }   // init(const GLint, const Formation, const Color)
 
+//
+// bool initRobots()
+// Last modified: 19Oct2026
+//
+// Constructs the [free] robots in bulk, placing them at the seed
+// positions (or randomly if there are too few seed positions),
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
 bool Environment::initRobots()
 {
-    if(initLocs.size()==nRobots*2)
+    if (nRobots <= 0) return true;
+    if ((robotPool = new Robot[nRobots]) == NULL) return false;
+    robots.reserve(robots.size() + nRobots);
+
+    bool useSeeds = seeds.getNPositions() >= (unsigned int)nRobots;
+    for (GLint i = 0; i < nRobots; ++i)
     {
-        for(int i=0;i<nRobots;i++)
-        {
-            float x,y;
-            x = initLocs.front();
-            initLocs.pop();
-            y = initLocs.front();
-            initLocs.pop();
-            addRobot(x,y,0.0,randSign() * frand(0.0f, 180.0f));
-        }
-    } else {
-        for (GLint i = 0; i < nRobots; ++i)
-            addRobot(randSign() * frand(),
-                     randSign() * frand(),
-                     0.0f,
-                     randSign() * frand(0.0f, 180.0f));
+        Robot *r = &robotPool[i];
+        if (useSeeds)
+            r->set(seeds.getX(i), seeds.getY(i), 0.0f);
+        else
+            r->set(randSign() * frand(), randSign() * frand(), 0.0f);
+        r->setHeading(randSign() * frand(0.0f, 180.0f));
+        r->setEnvironment(this);
+        robots.push_back(r);
     }
+    seeds.close();
     return true;
-}
+}   // initRobots()
+
+
 
 bool Environment::addRobot(GLfloat x, GLfloat y, GLfloat z, GLfloat theta)
 {
-    if (VERBOSE)
-        printf("new Robot(x = %.2f, y = %.2f, z = %.2f, theta = %.2f)\n",
-               x, y, z, theta);
+    LOG(LOG_TRACE, LOG_ROBOT,
+        "new Robot(x = %.2f, y = %.2f, z = %.2f, theta = %.2f)",
+        x, y, z, theta);
     Robot *r = new Robot(x, y, z, theta, DEFAULT_ROBOT_COLOR);
     r->setEnvironment(this);
     robots.push_back(r);
@@ -952,7 +1017,7 @@ bool Environment::addRobot(GLfloat x, GLfloat y, GLfloat z, GLfloat theta)
         c->setColor(DEFAULT_ROBOT_COLOR);
         c->setHeading(formation.getHeading());
         ++cells;
-		if(VERBOSE) printf("iterating through cells...\n");
+		LOG(LOG_TRACE, LOG_ENV, "iterating through cells...");
     }
 	newestCell = c;
 	//printf("newestCell == %d\n",c->getID());
@@ -987,7 +1052,7 @@ bool Environment::addRobot(GLfloat x, GLfloat y, GLfloat z, GLfloat theta)
         else c->rightNbr = c->nbrWithID(i + 1);
         ++cells;
     }
-	if(VERBOSE) printf("finished initNbrs()\n");
+	LOG(LOG_TRACE, LOG_ENV, "finished initNbrs()");
     return true;
 } */  // initNbrs(const GLint)
 
@@ -1119,6 +1184,7 @@ void Environment::formFromClick(GLfloat x, GLfloat y)
 	}
 	//c->setColor(MAGENTA);
 	c->setHeading(formation.getHeading());
+	if (chain.getSize() == 0) chain.insertFirst(c->getID());
 	newestCell = c;
     sendMsg(new Formation(formation), formation.getSeedID(),
                  ID_OPERATOR,      CHANGE_FORMATION);
@@ -1156,6 +1222,7 @@ Robot* Environment::getRobot(GLint id)
 void Environment::settlePushAuction(Cell* a,GLint bID)
 {
 	//cout << "entering env->settleAuction()" << endl;
+	Trace::instant("settle", "auction", "cell", a->getID(), "robot", bID);
 
 	if(robots.size()>0)
 	{
@@ -1163,13 +1230,13 @@ void Environment::settlePushAuction(Cell* a,GLint bID)
 		c = new Cell();
 		if(!addCell(c))
 		{
-			cout << "addCell() failed!" << endl;
+			LOG(LOG_ERROR, LOG_AUCTION, "addCell() failed!");
 			system("PAUSE");
 		}
 		Robot *r = getRobot(bID);
         if (r == NULL)
         {
-            cout << ">> ERROR: Robot[" << bID << "] not found!\n\n";
+            LOG(LOG_ERROR, LOG_AUCTION, "Robot[%d] not found!", bID);
             return;
         }
         c->x = r->x;
@@ -1193,32 +1260,36 @@ void Environment::settlePushAuction(Cell* a,GLint bID)
         {
             c->leftNbr  = c->nbrWithID(a->getID());
             a->rightNbr = a->nbrWithID(c->getID());
+            c->lftNbrID  = a->getID();
+            a->rghtNbrID = c->getID();
             //cout << "a->rightNbr = " << a->rightNbr->ID << endl;
+            chain.insertAfter(a->getID(), c->getID());
             newestCell  = c;
         }
         else if(a->leftNbr == NULL)
         {
             c->rightNbr = c->nbrWithID(a->getID());
             a->leftNbr  = a->nbrWithID(c->getID());
+            c->rghtNbrID = a->getID();
+            a->lftNbrID  = c->getID();
             //cout << "a->leftNbr = " << a->leftNbr->ID << endl;
+            chain.insertBefore(a->getID(), c->getID());
             newestCell  = c;
         }
-		formation.setFormationID(++formationID);
-		sendMsg(new Formation(formation),
-            formation.getSeedID(),
-            ID_OPERATOR,
-            CHANGE_FORMATION);
+		spliceFormation(c);
 	}
 }
 
 void Environment::settleInsertionAuction(Robot* r,GLint bID)
 {
-	cout << "entering env->settleInsertionAuction()" << endl;
+	LOG(LOG_DEBUG, LOG_AUCTION, "entering env->settleInsertionAuction()");
+	Trace::instant("settle", "auction", "robot", r->getID(), "cell", bID);
 	//exit(1);
 
 	if(robots.size()<1)
 	{
-        cout << "settle insertion auction called when robots.size() is < 1 " << endl;
+        LOG(LOG_ERROR, LOG_AUCTION,
+            "settle insertion auction called when robots.size() is < 1");
         exit(1);
 	}
 
@@ -1226,15 +1297,15 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
     b = new Cell();
     if(!addCell(b))
     {
-        cout << "addCell() failed!" << endl;
+        LOG(LOG_ERROR, LOG_AUCTION, "addCell() failed!");
         exit(1);
     }
-    cout << "just after cell creation" << endl;
+    LOG(LOG_DEBUG, LOG_AUCTION, "just after cell creation");
     Cell *a = getCell(bID);
     a->timeOfLastAuction = stepCount;
     if (a == NULL)
     {
-        cout << ">> ERROR: Robot[" << bID << "] not found!\n\n";
+        LOG(LOG_ERROR, LOG_AUCTION, "Cell[%d] not found!", bID);
         return;
     }
 
@@ -1256,8 +1327,10 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
     b->lftNbrID = b->rghtNbrID = DEFAULT_NEIGHBOR_ID;
 
 
-    cout << "About to set neighbor relations" << endl;
-    cout << "if a.id = "<< a->getID() << " and seed id = " << formation.getSeedID() << " then we're solid." << endl;
+    LOG(LOG_DEBUG, LOG_AUCTION, "About to set neighbor relations");
+    LOG(LOG_DEBUG, LOG_AUCTION,
+        "if a.id = %d and seed id = %d then we're solid.",
+        a->getID(), formation.getSeedID());
     Cell* c;
     if(a->getID() == formation.getSeedID())
     {
@@ -1269,6 +1342,7 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
             b->lftNbrID = a->getID();
             a->rightNbr = a->nbrWithID(b->getID());
             a->rghtNbrID = b->getID();
+            chain.insertAfter(a->getID(), b->getID());
 
         } else if(a->lftNbrID == DEFAULT_NEIGHBOR_ID) {
 
@@ -1278,27 +1352,31 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
             b->rghtNbrID = a->getID();
             a->leftNbr  = a->nbrWithID(b->getID());
             a->lftNbrID = b->getID();
-            cout << "n->leftNbr = " << a->leftNbr->ID << endl;
+            chain.insertBefore(a->getID(), b->getID());
+            LOG(LOG_DEBUG, LOG_AUCTION, "n->leftNbr = %d", a->leftNbr->ID);
             //newestCell  = c;
         }else{
-            cout << "Winner of auction was the seed, seed has two neighbors." << endl;
+            LOG(LOG_DEBUG, LOG_AUCTION,
+                "Winner of auction was the seed, seed has two neighbors.");
             if(getHopCount(a,LEFT) <= getHopCount(a,RIGHT))
             {
                 c = getCell(a->lftNbrID);
-                cout << "Calling insertCell("<<c->getID()<<", "<<b->getID()<<", "<<a->getID()<<") " << endl;
+                LOG(LOG_DEBUG, LOG_AUCTION, "Calling insertCell(%d, %d, %d)",
+                    c->getID(), b->getID(), a->getID());
                 insertCell(c,b,a);
             } else {
                 c = getCell(a->rghtNbrID);
-                cout << "Calling insertCell("<<a->getID()<<", "<<b->getID()<<", "<<c->getID()<<") " << endl;
+                LOG(LOG_DEBUG, LOG_AUCTION, "Calling insertCell(%d, %d, %d)",
+                    a->getID(), b->getID(), c->getID());
                 insertCell(a,b,c);
             }
         }
     } else {
 
-        cout << "wwwwwwwwwwwwwwwwwwww00000000000000000000000000000000000000000000000000000000000000ttttttttttttttttttttttttttttttttttttttttttttttt" << endl;
         c = getCell(a->nbrWithMinGradient()->ID);
 
-        cout << "a's "<<a->getID() << " nbrWithMinGradient was " << c->getID() << endl;
+        LOG(LOG_DEBUG, LOG_AUCTION, "a's %d nbrWithMinGradient was %d",
+            a->getID(), c->getID());
         //exit(1);
 
         if(c->rghtNbrID == a->getID())   //   seed<----(b)<==>(c)<==>(n)
@@ -1308,7 +1386,7 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
         {
             insertCell(a,b,c);
         }else{
-            cout << "no matching neighbors..." << endl;
+            LOG(LOG_ERROR, LOG_AUCTION, "no matching neighbors...");
             dieDisplayCells();
         }
         //newestCell = c;
@@ -1320,28 +1398,358 @@ void Environment::settleInsertionAuction(Robot* r,GLint bID)
             //if(c) c->showNeighbors();
 
 
-    formation.setFormationID(++formationID);
     //testCellNaN(c);
-    sendMsg(new Formation(formation),
-            formation.getSeedID(),
-            ID_OPERATOR,
-            CHANGE_FORMATION);
+    spliceFormation(b);
     //testCellNaN(c);
-    cout << "sent formation change message" << endl;
+    LOG(LOG_DEBUG, LOG_AUCTION, "spliced cell into formation");
     //b->processPackets();
     //testCellNaN(c);
     //b->updateState();
     //getCell(formation.getSeedID())->sendStateToNbrs();
     //system("PAUSE");
 
-    cout << endl << endl;
-    cout << "exiting settleInsertionAuction()" << endl;
+    LOG(LOG_DEBUG, LOG_AUCTION, "exiting settleInsertionAuction()");
 
 
 
     //displayStateOfEnv();
     //testCellNaN(c);
 }
+
+//
+// int announcePushAuctions()
+// Last modified: 19Oct2026
+//
+// Steps every cell, and has each cell that opens a push auction (an end
+// of the formation in position) announce the position beyond it,
+// returning the number of auctions announced.
+//
+// Returns:     the number of auctions announced
+// Parameters:  <none>
+//
+int Environment::announcePushAuctions()
+{
+    ProfileTimer timer(PHASE_CELLS);
+    int nAnnounced = 0;
+    for (GLint i = 0; i < getNCells(); ++i)
+    {
+        if(cells[i]->cStep())
+        {
+            Cell* a = cells[i];
+            auctions.push(a);
+            State s = a->getState();
+            bool dir = (a->rightNbr == NULL);
+            Push_Auction_Announcement* aa = new Push_Auction_Announcement(a->getState().gradient, s, dir);
+            sendMsg((Message)aa, ID_BROADCAST, a->getID(), PUSH_AUCTION_ANNOUNCEMENT);
+            Trace::instant("announce", "auction", "cell", a->getID());
+            a->setAuctionStepCount(1);
+            ++nAnnounced;
+        }
+    }
+    return nAnnounced;
+}   // announcePushAuctions()
+
+
+
+//
+// int announceInsertionAuctions()
+// Last modified: 19Oct2026
+//
+// Has the free robots that are ready to auction themselves announce their
+// insertion auctions, returning the number of auctions announced.  Only
+// the robots nearest the seed announce, up to AUCTION_ANNOUNCE_BUDGET per
+// step (the rest try again on the next step).
+//
+// Returns:     the number of auctions announced
+// Parameters:  <none>
+//
+int Environment::announceInsertionAuctions()
+{
+    ProfileTimer timer(PHASE_ANNOUNCE);
+    vector< pair<GLfloat, GLint> > announcers;
+    GLint nAvoided = 0;    // backing off or deferred (not open auctions)
+    Cell *seed = getCell(formation.getSeedID());
+    for(GLint i = 0; i < robots.size(); ++i)
+    {
+        if(robots[i]->auctioningStep()!=NULL)
+        {
+            GLfloat range = (seed == NULL) ? 0.0f : distanceToRobot(seed, robots[i]);
+            announcers.push_back(make_pair(range, i));
+        } else if(robots[i]->getAuctionStepCount() == 0) {
+            ++nAvoided;    // backing off (see Robot::closeAuction())
+        }
+    }
+
+    GLint nAnnounce = min((GLint)announcers.size(), (GLint)AUCTION_ANNOUNCE_BUDGET);
+    partial_sort(announcers.begin(), announcers.begin() + nAnnounce, announcers.end());
+    nAvoided += announcers.size() - nAnnounce;
+    for(GLint i = 0; i < nAnnounce; ++i)
+    {
+        Robot* a = robots[announcers[i].second];
+        Insertion_Auction_Announcement* aa = new Insertion_Auction_Announcement(a->getID());
+        sendMsg((Message)aa, ID_BROADCAST, a->getID(), INSERTION_AUCTION_ANNOUNCEMENT);
+        Trace::instant("announce", "auction", "robot", a->getID());
+        a->setAuctionStepCount(1);
+    }
+    totalAnnouncements   += nAnnounce;
+    avoidedAnnouncements += nAvoided;
+    avoidedDeliveries    += (long)nAvoided * cells.size();
+    return nAnnounce;
+}   // announceInsertionAuctions()
+
+
+
+//
+// void stepCells()
+// Last modified: 19Oct2026
+//
+// Steps every cell (without announcing auctions).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::stepCells()
+{
+    ProfileTimer timer(PHASE_CELLS);
+    for (GLint i = 0; i < getNCells(); ++i) cells[i]->cStep();
+}   // stepCells()
+
+
+
+//
+// void stepRobots()
+// Last modified: 19Oct2026
+//
+// Has every free robot process its packets and step.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::stepRobots()
+{
+    ProfileTimer timer(PHASE_ROBOTS);
+    for (GLint i = 0; i < robots.size(); ++i)
+    {
+        robots[i]->processPackets();
+        robots[i]->step();
+    }
+}   // stepRobots()
+
+
+
+//
+// void sendCellStates()
+// Last modified: 19Oct2026
+//
+// Has every cell with neighbors sense them and send its state to them
+// (in discrete message passing, once every cell has moved, so that the
+// states delivered at the start of the next step are not a move behind).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::sendCellStates()
+{
+    for (GLint i = 0; i < getNCells(); ++i)
+    {
+        if (cells[i]->getNNbrs() == 0) continue;
+        cells[i]->senseNbrs();
+        cells[i]->sendStateToNbrs();
+    }
+}   // sendCellStates()
+
+
+
+//
+// void receiveBids()
+// Last modified: 19Oct2026
+//
+// Has every free robot collect the bids on its open auction.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::receiveBids()
+{
+    ProfileTimer timer(PHASE_ROBOTS);
+    for (GLint i = 0; i < robots.size(); ++i) robots[i]->processPackets();
+}   // receiveBids()
+
+
+
+//
+// int settleInsertionAuctions(winners)
+// Last modified: 19Oct2026
+//
+// Settles every open insertion auction that does not conflict with a
+// better one, returning the number of auctions settled.  The winning bids
+// (chosen by the bid rule of the auction policy, see
+// settleInsertionAuctions<Select>()) are ranked by value (ties go to the
+// lower robot ID), and each auction
+// claims its winning cell and that cell's chain neighbors, since either
+// edge may be where the robot is inserted; an auction whose claim overlaps
+// a better auction's claim is deferred, and every other open auction is
+// closed, so those robots announce again on their next step (and the
+// cells may bid again).
+//
+// Returns:     the number of auctions settled
+// Parameters:
+//      winners     in/out  the winning bid of each open auction
+//
+int Environment::settleInsertionAuctions(vector< pair<Bid *, Robot *> > &winners)
+{
+    // rank the winning bids of the open auctions
+    sort(winners.begin(), winners.end(), winsBefore);
+
+    // claim the insertion edges (chain positions before any settle)
+    vector<bool>                   claimed(chain.getSize() + 2, false);
+    vector< pair<Robot *, GLint> > settled;
+    for (GLint i = 0; i < winners.size(); ++i)
+    {
+        GLint pos = chain.getPosition(winners[i].first->bID) + 1;
+        if ((pos == 0) || (claimed[pos - 1]) || (claimed[pos]) ||
+            (claimed[pos + 1])) continue;
+        claimed[pos - 1] = claimed[pos] = claimed[pos + 1] = true;
+        settled.push_back(make_pair(winners[i].second,
+                                    winners[i].first->bID));
+    }
+
+    // close every auction (settled robots leave the robot list)
+    for (GLint i = 0; i < robots.size(); ++i) robots[i]->closeAuction();
+    for (GLint i = 0; i < settled.size(); ++i)
+        settleInsertionAuction(settled[i].first, settled[i].second);
+    for (GLint i = 0; i < cells.size(); ++i) cells[i]->outstandingBid = 0;
+    return settled.size();
+}   // settleInsertionAuctions(vector< pair<Bid *, Robot *> > &)
+
+
+
+//
+// void bidOnPushAuctions()
+// Last modified: 19Oct2026
+//
+// Has every robot bid on the push auctions announced this step, computing
+// the range from every robot to every position being auctioned in one
+// pass of the bid kernel (in place of each robot's range sensor).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::bidOnPushAuctions()
+{
+    ProfileTimer timer(PHASE_BID);
+    bidKernel.clear();
+    for (GLint i = 0; i < pushAnnouncements.size(); ++i)
+    {
+        Push_Auction_Announcement *aa =
+            (Push_Auction_Announcement *)pushAnnouncements[i].msg;
+        Cell *a = getCell(pushAnnouncements[i].fromID);
+        if (a != NULL)
+        {
+            // the position being auctioned is one formation radius away,
+            // to the right (or left) of the auctioneer
+            Formation f = aa->s_i.formation;
+            Vector    e;
+            e.y = f.getFunction()(f.getRadius());
+            e.x = sqrt((f.getRadius() * f.getRadius()) - (e.y * e.y));
+            GLfloat dir = (aa->right) ? 1.0f : -1.0f;
+            bidKernel.addAuction(a->getID(), a->x, a->y, dir * e.x, dir * e.y);
+        }
+        delete aa;
+    }
+    pushAnnouncements.clear();
+    if (bidKernel.getNAuctions() == 0) return;
+
+    for (GLint i = 0; i < robots.size(); ++i)
+        bidKernel.addBidder(robots[i]->getID(), robots[i]->x, robots[i]->y);
+    bidKernel.computeRanges(SENSOR_RANGE);
+    for (GLint i = 0; i < robots.size(); ++i)
+        robots[i]->bidOnPushAuctions(bidKernel, i);
+}   // bidOnPushAuctions()
+
+
+
+//
+// void bidOnInsertionAuctions()
+// Last modified: 19Oct2026
+//
+// Has every cell in position bid on its nearest insertion auctions
+// announced this step, ranking the auctions of every cell in one pass
+// of the bid kernel.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Environment::bidOnInsertionAuctions()
+{
+    ProfileTimer timer(PHASE_BID);
+    bidKernel.clear();
+    for (GLint i = 0; i < insertionAnnouncements.size(); ++i)
+    {
+        Insertion_Auction_Announcement *aa =
+            (Insertion_Auction_Announcement *)insertionAnnouncements[i].msg;
+        Robot *r = getRobot(aa->aID);
+        if (r != NULL) bidKernel.addAuction(r->getID(), r->x, r->y);
+        delete aa;
+    }
+    insertionAnnouncements.clear();
+    if (bidKernel.getNAuctions() == 0) return;
+
+    vector<Cell *> bidders;
+    for (GLint i = 0; i < cells.size(); ++i)
+    {
+        if (!cells[i]->canBidOnInsertionAuction()) continue;
+        bidKernel.addBidder(cells[i]->getID(), cells[i]->x, cells[i]->y);
+        bidders.push_back(cells[i]);
+    }
+    bidKernel.computeNearest(INSERTION_MAX_BIDS, SENSOR_RANGE);
+    for (GLint i = 0; i < bidders.size(); ++i)
+        bidders[i]->bidOnInsertionAuction(bidKernel, i);
+}   // bidOnInsertionAuctions()
+
+
+
+//
+// bool spliceFormation(c)
+// Last modified: 19Oct2026
+//
+// Attempts to bring a cell just spliced into the formation chain into
+// formation locally, returning true if successful, false otherwise.  The
+// cell solves its gradient directly from its upstream neighbor (toward the
+// seed) under a new formation ID, and its downstream neighbor is relinked
+// to follow it, so only the cells downstream of the insertion point change
+// formation (see Cell::updateState()); the rest of the formation keeps its
+// state and relationships, and nothing is broadcast from the seed.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      c       in/out  the cell spliced into the chain
+//
+bool Environment::spliceFormation(Cell *c)
+{
+    formation.setFormationID(++formationID);
+    Trace::instant("formation", "formation", "formationID", formationID,
+                   "cell", (c == NULL) ? ID_NO_NBR : c->getID());
+    if ((c == NULL) || (!chain.contains(c->getID()))) return false;
+
+    // the chain neighbors of the cell toward and away from the seed
+    GLint pos = chain.getPosition(c->getID());
+    GLint dir = (pos > chain.getPosition(formation.getSeedID())) ? -1 : 1;
+    Cell  *up = getCellAt(pos + dir), *down = getCellAt(pos - dir);
+    if ((up == NULL) || (c->nbrWithID(up->getID()) == NULL)) return false;
+
+    // the upstream cell keeps its gradient, relating it to its new neighbor
+    up->refreshRelationships();
+    c->updateNbr(up->getID(), up->getState());
+    Formation f = up->formation;
+    f.setFormationID(formationID);
+    if (!c->changeFormation(f, *c->nbrWithID(up->getID()))) return false;
+    if ((down != NULL) && (down->updateNbr(c->getID(), c->getState())))
+        down->upstreamID = c->getID();
+    return true;
+}   // spliceFormation(Cell *)
+
+
 
 void Environment::testCellNaN(Cell * c)
 {
@@ -1393,7 +1801,73 @@ bool Environment::useInsertion()
     if(insertion) return 1;
     else return 0;
 }
+
+
+
+//
+// void setInsertion(insert)
+// Last modified: 19Oct2026
+//
+// Switches every cell (and every cell added later) to the insertion
+// protocol (or back to the push protocol).  Switching to insertion closes
+// the open push auctions unsettled, since the cells holding them may no
+// longer be ends of the formation once robots are inserted.
+//
+// Returns:     <none>
+// Parameters:
+//      insert  in      true for the insertion protocol, false for push
+//
+void Environment::setInsertion(const bool insert)
+{
+    insertion = insert;
+    for (GLint i = 0; i < getNCells(); ++i) cells[i]->insertion = insert;
+    while ((insert) && (!auctions.empty()))
+    {
+        auctions.front()->settleAuction(NULL);
+        auctions.pop();
+    }
+}   // setInsertion(const bool)
 
+
+
+//
+// bool useDiscrete() const
+// Last modified: 19Oct2026
+//
+// Returns true if packets addressed to a cell or robot are delivered at
+// the start of the next step (discrete message passing), false if they
+// are delivered as they are sent (continuous message passing).
+//
+// Returns:     true if discrete, false if continuous
+// Parameters:  <none>
+//
+bool Environment::useDiscrete() const
+{
+    return discrete;
+}   // useDiscrete() const
+
+
+
+//
+// void setDiscrete(d)
+// Last modified: 19Oct2026
+//
+// Switches to discrete (or back to continuous) message passing.  In
+// discrete message passing, every packet addressed to a cell or robot
+// during a step is delivered at the start of the next step, so that what
+// an agent receives does not depend on the order in which the agents are
+// stepped.
+//
+// Returns:     <none>
+// Parameters:
+//      d       in      true for discrete, false for continuous
+//
+void Environment::setDiscrete(const bool d)
+{
+    discrete = d;
+    if (!discrete) forwardPackets();
+}   // setDiscrete(const bool)
+
 void Environment::displayNeighborhood(Cell *c)
 {
 
@@ -1582,42 +2056,35 @@ void Environment::displayStateOfEnv()
     return answer;
 }*/
 
+//
+// int getHopCount(c, d)
+// Last modified: 19Oct2026
+//
+// Returns the number of cells between the parameterized cell and the end
+// of the formation chain in the parameterized direction, looked up in the
+// chain index (O(log N)) rather than walked neighbor by neighbor.
+//
+// Returns:     the number of hops to the end of the chain
+// Parameters:
+//      c       in      the cell being counted from
+//      d       in      the direction (LEFT or RIGHT) being counted
+//
 int Environment::getHopCount(Cell * c, Direction d)
 {
-    int answer=0;
-    Cell * current = c;
-
-    if(d == RIGHT)
+    if (!chain.contains(c->getID()))
     {
-        while(current->rghtNbrID > DEFAULT_NEIGHBOR_ID)
-        {
-            answer++;
-            if(answer > cells.size())
-            {
-                cout << "There is an anomaly in Neighborland. More cells down one branch than there are total...." << endl;
-                //exit(1);
-                dieDisplayCells();
-            }
-            current = getCell(current->rghtNbrID);
-        }
-        cout << "RIGHT hopCount = " << answer << endl;
-    } else {
-        while(current->lftNbrID > DEFAULT_NEIGHBOR_ID)
-        {
-            answer++;
-            if(answer >= cells.size())
-            {
-                cout << "There is an anomaly in Neighborland. More cells down one branch than there are total...." << endl;
-                //exit(1);
-                dieDisplayCells();
-            }
-            current = getCell(current->lftNbrID);
-        }
-        cout << "LEFT hopCount = " << answer << endl;
+        LOG(LOG_ERROR, LOG_FORMATION,
+            "There is an anomaly in Neighborland. Cell %d is not in the chain....",
+            c->getID());
+        dieDisplayCells();
     }
+    int answer = (d == RIGHT) ? chain.getNRightOf(c->getID()) :
+                                chain.getNLeftOf(c->getID());
+    LOG(LOG_DEBUG, LOG_FORMATION, "%s hopCount = %d",
+        (d == RIGHT) ? "RIGHT" : "LEFT", answer);
 
     return answer;
-}
+}   // getHopCount(Cell *, Direction)
 
 void Environment::dieDisplayCells()
 {
@@ -1633,9 +2100,12 @@ void Environment::insertCell(Cell* a, Cell *b, Cell* c)
 {
     //Cells a and c are currently neighbors, and b should be placed between them
 
-    displayNeighborhood(a);
-    displayNeighborhood(b);
-    displayNeighborhood(c);
+    if (LOG_ENABLED(LOG_DEBUG, LOG_FORMATION))
+    {
+        displayNeighborhood(a);
+        displayNeighborhood(b);
+        displayNeighborhood(c);
+    }
 
 
     int ac = a->getID(), bc = b->getID(), cc = c->getID();
@@ -1673,6 +2143,7 @@ void Environment::insertCell(Cell* a, Cell *b, Cell* c)
     b->lftNbrID = ac;
     b->rightNbr = b->nbrWithID(cc);
     b->rghtNbrID = cc;
+    chain.insertAfter(ac, bc);
 
 
 
@@ -1684,9 +2155,12 @@ void Environment::insertCell(Cell* a, Cell *b, Cell* c)
     //a->updateState();
     //c->updateState();
     //displayStateOfEnv();
-    displayNeighborhood(a);
-    displayNeighborhood(b);
-    displayNeighborhood(c);
+    if (LOG_ENABLED(LOG_DEBUG, LOG_FORMATION))
+    {
+        displayNeighborhood(a);
+        displayNeighborhood(b);
+        displayNeighborhood(c);
+    }
 
     //    /--b--\
     //   a<=====>c
@@ -1758,7 +2232,8 @@ void Environment::writeDistanceData(char * filename,char * filename2)
             overallDistance += cells[i]->getDistanceTraveled();
         }
 
-        cout << cells[i]->getID() <<", "<< cells[i]->getDistanceTraveled() << endl;
+        LOG(LOG_DEBUG, LOG_CELL, "%d, %g",
+            cells[i]->getID(), cells[i]->getDistanceTraveled());
 
         /*if(1)// cells[i]->getDistanceTraveled() > 1.0 )
         {
@@ -1842,15 +2317,47 @@ void Environment::writeFinalPositions()
     os.close();
 }
 
+//
+// void writeTrajectory(os)
+// Last modified: 19Oct2026
+//
+// Writes the position and heading of every cell and [free] robot
+// at this step (one "step,kind,id,x,y,heading" line each, kind being
+// 'c' or 'r') to the parameterized stream, with enough digits for the
+// values to be read back exactly.
+//
+// Returns:     <none>
+// Parameters:
+//      os      in/out  the stream written to
+//
+void Environment::writeTrajectory(ostream &os)
+{
+    char line[128];
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        sprintf(line, "%d,c,%d,%.9g,%.9g,%.9g\n", stepCount, cells[i]->getID(),
+                cells[i]->x, cells[i]->y, cells[i]->getHeading());
+        os << line;
+    }
+    for (size_t i = 0; i < robots.size(); ++i)
+    {
+        sprintf(line, "%d,r,%d,%.9g,%.9g,%.9g\n", stepCount, robots[i]->getID(),
+                robots[i]->x, robots[i]->y, robots[i]->getHeading());
+        os << line;
+    }
+}   // writeTrajectory(ostream &)
+
+
+
 void Environment::writeHeader()
 {
     ofstream os;
     os.open("summary.out");
     os << "Random Seed File:  " << inputFile << endl;
+    os << "Random Seed: " << randomSeed << endl;
     os << "Total Initial Robots: " << nRobots << endl;
     os << "Formation Type: " << formation.getFunction() << endl;
-    if(INSERTION) os << "Insertion Auction" << endl;
-    if(!INSERTION) os << "Push Auction" << endl;
+    os << auctionPolicy->title << endl;
     int convergence_total=0;
     int num_cells_converged=0;
     for(int i=0;i<cells.size();i++)
@@ -1871,6 +2378,11 @@ void Environment::writeHeader()
 
     os << "TOTAL_MESSAGES_SENT:  " << totalMessages << endl;
     os << "AVERAGE_MESSAGES_SENT:  " << (float)totalMessages/(float)cells.size() << endl;
+    os << "TOTAL_ANNOUNCEMENTS_SENT:  " << totalAnnouncements << endl;
+    os << "TOTAL_ANNOUNCEMENTS_AVOIDED:  " << avoidedAnnouncements << endl;
+    os << "TOTAL_DELIVERIES_AVOIDED:  " << avoidedDeliveries << endl;
+    os << "TOTAL_MAILBOX_OVERFLOWS:  " << mailboxOverflows << endl;
+    os << "TOTAL_PACKETS_COALESCED:  " << coalescedPackets << endl;
 
 
     cout << "Total Converged Cells:  " << num_cells_converged << endl;
@@ -1878,6 +2390,14 @@ void Environment::writeHeader()
     cout << "Average Steps to convergence:  " << (float)convergence_total/(float)num_cells_converged << endl;
     cout << "Total Messages sent :  " << totalMessages << endl;
     cout << "Average Messages :   " << (float)totalMessages/(float)cells.size() << endl;
+    cout << "Announcements sent :  " << totalAnnouncements
+         << "   avoided :  " << avoidedAnnouncements
+         << " (" << avoidedDeliveries << " deliveries)" << endl;
+    cout << "Mailbox overflows :  " << mailboxOverflows
+         << "   peak :  " << mailboxPeak << " packets ("
+         << MAILBOX_CAPACITY << " held per mailbox"
+         << (discrete ? ", discrete" : "") << ")"
+         << "   coalesced :  " << coalescedPackets << endl;
     //os << endl << endl;
     //os << "[DATA]"<<endl;
     os.close();
@@ -1934,3 +2454,74 @@ bool Environment::quiescence()
     }
     return false;
 }
+
+
+
+// <protected static utility functions>
+
+//
+// bool winsBefore(a, b)
+// Last modified: 19Oct2026
+//
+// Returns true if the first (winning bid, robot) pair ranks before the
+// second, i.e., it has the lower bid or, on a tie, the lower robot ID.
+//
+// Returns:     true if the first pair ranks first, false otherwise
+// Parameters:
+//      a       in      the first (winning bid, robot) pair
+//      b       in      the second (winning bid, robot) pair
+//
+bool Environment::winsBefore(const pair<Bid *, Robot *> &a,
+                             const pair<Bid *, Robot *> &b)
+{
+    if (a.first->b_i != b.first->b_i) return a.first->b_i < b.first->b_i;
+    return a.second->getID() < b.second->getID();
+}   // winsBefore(const pair<Bid *, Robot *> &, const pair<Bid *, Robot *> &)
+
+
+
+//
+// void deleteMessage(p)
+// Last modified: 19Oct2026
+//
+// Deletes the message of the parameterized packet (one that could not be
+// delivered), if it owns one (i.e., a state or formation).
+//
+// Returns:     <none>
+// Parameters:
+//      p       in      the packet whose message is deleted
+//
+void Environment::deleteMessage(const Packet &p)
+{
+    if (p.msg == NULL) return;
+    if      (p.type == STATE)            delete (State *)p.msg;
+    else if (p.type == CHANGE_FORMATION) delete (Formation *)p.msg;
+}   // deleteMessage(const Packet &)
+
+
+
+//
+// bool supersedes(p, q)
+// Last modified: 19Oct2026
+//
+// Returns true if the first packet supersedes the second (queued) packet
+// of the same sender and type (see forwardPacket()), i.e., both are
+// states (only the newest state of a neighbor matters) or formation
+// changes, the first to a later formation (or to the same formation,
+// which the operator changes in place, see changeFormation()).
+//
+// Returns:     true if the first packet supersedes the second
+// Parameters:
+//      p       in      the packet being queued
+//      q       in      the packet already queued
+//
+bool Environment::supersedes(const Packet &p, const Packet &q)
+{
+    if ((p.fromID != q.fromID) || (p.type != q.type) ||
+        (p.msg == NULL) || (q.msg == NULL)) return false;
+    if (p.type == STATE) return true;
+    return (p.type == CHANGE_FORMATION) &&
+           ((p.msg == q.msg) ||
+            (((Formation *)q.msg)->getFormationID() <
+             ((Formation *)p.msg)->getFormationID()));
+}   // supersedes(const Packet &, const Packet &)
@@ -10,22 +10,25 @@
 // preprocessor directives
 #ifndef ENVIRONMENT_H
 #define ENVIRONMENT_H
+#include <algorithm>
 #include <queue>
 #include <time.h>
 #include <vector>
 #include <stack>
 #include <fstream>
 #include "Cell.h"
+#include "ChainIndex.h"
+#include "BidKernel.h"
+#include "Profiler.h"
 #include "Log.h"
+#include "SeedFile.h"
+#include "Snapshot.h"
 using namespace std;
 
 
 
 //
-#define VERBOSE (0)
 #define QUIESCENCE_COUNT (5)
-#define INSERTION_RANDOM (0)
-#define PUSH_RANDOM (0)
 
 
 
@@ -33,6 +36,14 @@ using namespace std;
 static const Color DEFAULT_ENV_COLOR = BLACK;
 
 
+
+// auction policy (see AuctionPolicy.h)
+struct AuctionPolicy;
+
+// entity of the state ring (see StateRing.h)
+struct RingEntity;
+
+
 
 // describes a robot cell environment
 class Environment
@@ -50,7 +61,9 @@ class Environment
                     const Color     colorIndex = DEFAULT_ENV_COLOR,
                     const int       insertion  = 0,
                     const float     max_t_error = MAX_TRANSLATIONAL_ERROR,
-                    string          randInput = "randOut.txt");
+                    string          randInput = "randOut.txt",
+                    string          policy    = "",
+                    const unsigned int seed   = 0);
         Environment(const Environment &e);
 
         // <destructors>
@@ -73,16 +86,22 @@ class Environment
 
         // <public accessor functions>
         Cell*               getCell(GLint pos) const;
+        Cell*               getCellAt(const GLint pos) const;
         Robot*              getRobot(GLint id);
         vector<Cell *>  getCells();
         vector<Robot *> getRobots();
         GLint               getNCells() const;
         GLint               getNFreeRobots() const;
+        GLint               getNMessages() const;
+        GLfloat             getError() const;
 
 
         // <virtual public utility functions>
         virtual void draw();
         virtual bool step();
+        void         capture(Snapshot &s);
+        GLint        exportState(RingEntity *entities,
+                                 const GLint maxEntities) const;
         virtual void clear();
 
         // <public utility functions>
@@ -110,6 +129,9 @@ class Environment
         bool    showPos(const bool show);
         bool    showHeading(const bool show);
         bool    useInsertion();
+        void    setInsertion(const bool insert);
+        bool    useDiscrete() const;
+        void    setDiscrete(const bool d);
         void    testCellNaN(Cell * c);
 
 
@@ -124,9 +146,10 @@ class Environment
         bool    changeFormation(Formation &f);
         void    settlePushAuction(Cell* c,GLint bID);
         void    settleInsertionAuction(Robot* c,GLint bID);
+        bool    spliceFormation(Cell *c);
         void    writeDistanceData(char * filename,char * filename2);
         void    displayStateOfEnv();
-        int     getHopCount(Cell * c, Direction d);    // set direction to true for hop count down the rightNbr and false for the leftNbr
+        int     getHopCount(Cell * c, Direction d);    // number of cells down the rightNbr (RIGHT) or leftNbr (LEFT) side
         void    displayNeighborhood(Cell * c);
         void    dieDisplayCells();
         void    insertCell(Cell* a, Cell *b, Cell* c);
@@ -139,24 +162,56 @@ class Environment
         bool    quiescence();
         void    writeHeader();
         void    writeFinalPositions();
+        void    writeTrajectory(ostream &os);
+
+        // <public auction phase functions> (composed by the auction
+        // policies into their step kernels, see AuctionPolicy.h)
+        int     announcePushAuctions();
+        int     announceInsertionAuctions();
+        void    stepCells();
+        void    stepRobots();
+        void    sendCellStates();
+        void    receiveBids();
+        void    bidOnPushAuctions();
+        void    bidOnInsertionAuctions();
+        template <class Select>
+        int     settlePushAuctions(const int nSteps);
+        template <class Select>
+        int     settleInsertionAuctions();
+        int     settleInsertionAuctions(vector< pair<Bid *, Robot *> > &winners);
 
         //ostream &st);
         //void    summaryReport(ostream &os);
         int     stepCount;
+        unsigned int randomSeed;    // seed of rand() (see init())
     protected:
 
         // <protected data members>
         vector<Cell *>          cells;
+        vector<Cell *>          cellsByID;      // cells indexed by ID
+        ChainIndex              chain;          // left-to-right cell order
+        BidKernel               bidKernel;      // bids of the step
+        vector<Packet>          pushAnnouncements;
+        vector<Packet>          insertionAnnouncements;
         vector<Robot *>         robots;
-        queue<Packet>           msgQueue;
-        queue<float>           initLocs;
+        vector<Packet>          msgQueue;       // sent, delivered next step
+        SeedFile                seeds;
+        Robot                  *robotPool;
         queue<Cell *>           auctions;
         Cell                    *newestCell;
         Formation               formation;
         GLint                   nRobots;
         Color                   defaultColor;
         int                     insertion;
+        const AuctionPolicy    *auctionPolicy;
         int                     totalMessages;
+        int                     totalAnnouncements;     // insertion auctions
+        int                     avoidedAnnouncements;   // throttled
+        long                    avoidedDeliveries;      // throttled * cells
+        bool                    discrete;       // delivers at the next step
+        long                    mailboxOverflows;       // packets spilled
+        GLint                   mailboxPeak;    // packets queued (at most)
+        long                    coalescedPackets;       // superseded
         vector<Message_Log>     allMessages;
         vector<Packet>          messagesPerStep;
         vector<Error_Log>       errorSum;
@@ -177,11 +232,19 @@ class Environment
                           const Formation f          = Formation(),
                           const Color     colorIndex = DEFAULT_ENV_COLOR,
                           const int       insert     = 0,
-                          const float     max_t_error = MAX_TRANSLATIONAL_ERROR);
+                          const float     max_t_error = MAX_TRANSLATIONAL_ERROR,
+                          const string    policy     = "",
+                          const unsigned int seed    = 0);
         //virtual bool initCells(const GLint     n = 0,
         //                       const Formation f = Formation());
         //virtual bool initNbrs(const GLint nNbrs = 0);
 		virtual bool initRobots();
+
+        // <protected static utility functions>
+        static bool winsBefore(const pair<Bid *, Robot *> &a,
+                               const pair<Bid *, Robot *> &b);
+        static void deleteMessage(const Packet &p);
+        static bool supersedes(const Packet &p, const Packet &q);
 };  // Environment
 
 #endif
@@ -0,0 +1,238 @@
+//
+// Filename:        "FlightRecorder.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the step latency recorder of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include "FlightRecorder.h"
+#include "Profiler.h"
+
+
+
+// <static data members>
+bool       FlightRecorder::enabled                       = false;
+double     FlightRecorder::budget                        = 0.0;
+string     FlightRecorder::filename                      = FLIGHT_RECORDER_FILE;
+long       FlightRecorder::buckets[HISTOGRAM_N_BUCKETS]  = {0};
+long       FlightRecorder::nSteps                        = 0;
+double     FlightRecorder::maxSeconds                    = 0.0;
+StepRecord FlightRecorder::current                       = StepRecord();
+StepRecord FlightRecorder::ring[FLIGHT_RECORDER_STEPS];
+long       FlightRecorder::lastDumped                    = -1;
+long       FlightRecorder::nDumps                        = 0;
+
+
+
+// <public static mutator functions>
+
+//
+// void enable(budgetSeconds, filename)
+// Last modified: 19Oct2026
+//
+// Enables recording, dumping the flight recorder to the parameterized
+// file whenever a step takes longer than the parameterized budget
+// (never, if the budget is not positive).
+//
+// Returns:     <none>
+// Parameters:
+//      budgetSeconds   in      the step budget (in seconds)
+//      filename        in      the name of the flight recorder file
+//
+void FlightRecorder::enable(const double budgetSeconds, const string &filename)
+{
+    enabled                  = true;
+    budget                   = budgetSeconds;
+    FlightRecorder::filename = filename;
+}   // enable(const double, const string &)
+
+
+
+//
+// void addTime(phase, seconds)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized time to the parameterized phase
+// of the current step.
+//
+// Returns:     <none>
+// Parameters:
+//      phase   in      the phase that was timed
+//      seconds in      the time spent in the phase
+//
+void FlightRecorder::addTime(const int phase, const double seconds)
+{
+    if ((phase >= 0) && (phase < FLIGHT_RECORDER_PHASES))
+        current.phaseSeconds[phase] += seconds;
+}   // addTime(const int, const double)
+
+
+
+//
+// void addStep(seconds)
+// Last modified: 19Oct2026
+//
+// Completes the current step, which took the parameterized time,
+// recording it in the histogram and the ring (and dumping the ring
+// if the step exceeded the budget).
+//
+// Returns:     <none>
+// Parameters:
+//      seconds in      the time spent in the step
+//
+void FlightRecorder::addStep(const double seconds)
+{
+    ++buckets[getBucket((long)(seconds * 1e6))];
+    if (seconds > maxSeconds) maxSeconds = seconds;
+
+    current.step    = nSteps;
+    current.seconds = seconds;
+    ring[nSteps % FLIGHT_RECORDER_STEPS] = current;
+    if ((budget > 0.0) && (seconds > budget)) dump();
+    ++nSteps;
+    current = StepRecord();
+}   // addStep(const double)
+
+
+
+// <public static accessor functions>
+
+//
+// double getPercentile(percentile)
+// Last modified: 19Oct2026
+//
+// Returns the step duration (in seconds) at the parameterized percentile
+// (the highest duration of its histogram bucket, at most the maximum).
+//
+// Returns:     the step duration at the percentile
+// Parameters:
+//      percentile  in      the percentile [0, 100]
+//
+double FlightRecorder::getPercentile(const double percentile)
+{
+    if (nSteps == 0) return 0.0;
+    long rank = (long)ceil(percentile / 100.0 * nSteps), count = 0;
+    if (rank < 1) rank = 1;
+    for (int i = 0; i < HISTOGRAM_N_BUCKETS; ++i)
+    {
+        count += buckets[i];
+        if (count >= rank) return min(getBucketMax(i) * 1e-6, maxSeconds);
+    }
+    return maxSeconds;
+}   // getPercentile(const double)
+
+
+
+//
+// void report(out)
+// Last modified: 19Oct2026
+//
+// Writes the step latency summary to the parameterized stream.
+//
+// Returns:     <none>
+// Parameters:
+//      out     in/out  the stream written to
+//
+void FlightRecorder::report(ostream &out)
+{
+    out << setiosflags(ios::fixed) << setprecision(3)
+        << "Step latency (" << nSteps << " steps):"
+        << "  p50 = "  << getPercentile(50.0) * 1e3 << " ms"
+        << "  p90 = "  << getPercentile(90.0) * 1e3 << " ms"
+        << "  p99 = "  << getPercentile(99.0) * 1e3 << " ms"
+        << "  max = "  << maxSeconds          * 1e3 << " ms" << endl;
+    if (budget > 0.0)
+        out << "Slow steps (> " << budget * 1e3 << " ms) dumped : " << nDumps
+            << " (to " << filename << ")" << endl;
+    out << resetiosflags(ios::fixed) << setprecision(6);
+}   // report(ostream &)
+
+
+
+// <protected static utility functions>
+
+//
+// int getBucket(micros)
+// Last modified: 19Oct2026
+//
+// Returns the histogram bucket of the parameterized duration.
+//
+// Returns:     the histogram bucket of the duration
+// Parameters:
+//      micros  in      the duration (in microseconds)
+//
+int FlightRecorder::getBucket(const long micros)
+{
+    const long nSub = 1L << HISTOGRAM_SUB_BITS;
+    if (micros < nSub) return (micros < 0) ? 0 : (int)micros;
+    int magnitude = 0;
+    for (long v = micros; v > 1; v >>= 1) ++magnitude;
+    int shift = magnitude - HISTOGRAM_SUB_BITS + 1;
+    return (int)(shift * (nSub / 2) + (micros >> shift));
+}   // getBucket(const long)
+
+
+
+//
+// long getBucketMax(bucket)
+// Last modified: 19Oct2026
+//
+// Returns the highest duration (in microseconds)
+// of the parameterized histogram bucket.
+//
+// Returns:     the highest duration of the bucket
+// Parameters:
+//      bucket  in      the histogram bucket
+//
+long FlightRecorder::getBucketMax(const int bucket)
+{
+    const long nSub = 1L << HISTOGRAM_SUB_BITS;
+    if (bucket < nSub) return bucket;
+    int  shift = (int)(bucket / (nSub / 2)) - 1;
+    long sub   = bucket - shift * (nSub / 2);
+    return ((sub + 1) << shift) - 1;
+}   // getBucketMax(const int)
+
+
+
+//
+// void dump()
+// Last modified: 19Oct2026
+//
+// Appends the steps in the ring (since the last dump) to the flight
+// recorder file, ending with the current (slow) step.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void FlightRecorder::dump()
+{
+    ofstream os(filename.c_str(), ios::app);
+    if (!os) return;
+    long first = max(lastDumped + 1, nSteps - FLIGHT_RECORDER_STEPS + 1);
+    os << setiosflags(ios::fixed) << setprecision(3)
+       << "# slow step " << nSteps << ": " << current.seconds * 1e3
+       << " ms (budget " << budget * 1e3 << " ms)" << endl
+       << "step,total_ms";
+    for (int i = 0; i < N_PROFILE_PHASES; ++i)
+        os << "," << Profiler::getPhaseName(i) << "_ms";
+    os << ",packets,state_copies,formation_solves" << endl;
+    for (long s = first; s <= nSteps; ++s)
+    {
+        const StepRecord &r = ring[s % FLIGHT_RECORDER_STEPS];
+        os << r.step << "," << r.seconds * 1e3;
+        for (int i = 0; i < N_PROFILE_PHASES; ++i)
+            os << "," << r.phaseSeconds[i] * 1e3;
+        os << "," << r.packets << "," << r.stateCopies << ","
+           << r.formationSolves << endl;
+    }
+    os << endl;
+    lastDumped = nSteps;
+    ++nDumps;
+}   // dump()
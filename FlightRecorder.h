@@ -0,0 +1,105 @@
+//
+// Filename:        "FlightRecorder.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the step latency recorder of the
+//                  simulation, which keeps a (log-linear, HDR-style)
+//                  histogram of step durations, reported at exit, and a
+//                  flight recorder: a ring of the phase timings and event
+//                  counts of the last FLIGHT_RECORDER_STEPS steps, dumped
+//                  whenever a step exceeds the step budget.  Every hook
+//                  checks one flag when recording is disabled.
+//
+//                  The histogram buckets are exact below
+//                  2^HISTOGRAM_SUB_BITS microseconds and within
+//                  1 / 2^(HISTOGRAM_SUB_BITS - 1) of the duration above.
+//
+
+// preprocessor directives
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+#include <iostream>
+#include <string>
+using namespace std;
+
+
+
+// flight recorder definitions
+#define FLIGHT_RECORDER_STEPS  (64)                 // steps in the ring
+#define FLIGHT_RECORDER_PHASES (8)                  // >= N_PROFILE_PHASES
+#define FLIGHT_RECORDER_FILE   ("flightrecorder.out")
+#define HISTOGRAM_SUB_BITS     (5)                  // 32 sub-buckets
+#define HISTOGRAM_N_BUCKETS    (1024)
+
+
+
+// describes the record of one step
+struct StepRecord
+{
+    long   step;
+    double seconds;
+    double phaseSeconds[FLIGHT_RECORDER_PHASES];
+    long   packets;
+    long   stateCopies;
+    long   formationSolves;
+};  // StepRecord
+
+
+
+// describes the (process-wide) step latency recorder
+class FlightRecorder
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static void enable(const double budgetSeconds,
+                           const string &filename = FLIGHT_RECORDER_FILE);
+        static void addTime(const int phase, const double seconds);
+        static void addStep(const double seconds);
+
+        // counts a packet sent during the current step
+        static void countPacket()
+        {
+            if (enabled) ++current.packets;
+        }   // countPacket()
+
+        // counts a copy of a cell state during the current step
+        static void countStateCopy()
+        {
+            if (enabled) ++current.stateCopies;
+        }   // countStateCopy()
+
+        // counts a formation solve during the current step
+        static void countFormationSolve()
+        {
+            if (enabled) ++current.formationSolves;
+        }   // countFormationSolve()
+
+        // <public static accessor functions>
+        static double getPercentile(const double percentile);
+        static void   report(ostream &out = cout);
+
+    protected:
+
+        // <protected static data members>
+        static double     budget;           // slow-step threshold (seconds)
+        static string     filename;
+        static long       buckets[HISTOGRAM_N_BUCKETS];
+        static long       nSteps;
+        static double     maxSeconds;
+        static StepRecord current;
+        static StepRecord ring[FLIGHT_RECORDER_STEPS];
+        static long       lastDumped;       // the last step dumped
+        static long       nDumps;
+
+        // <protected static utility functions>
+        static int  getBucket(const long micros);
+        static long getBucketMax(const int bucket);
+        static void dump();
+};  // FlightRecorder
+
+#endif
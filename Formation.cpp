@@ -9,6 +9,7 @@
 
 // preprocessor directives
 #include "Formation.h"
+#include "Profiler.h"
 
 
 
@@ -488,6 +489,7 @@ Vector Formation::getRelationship(const Function f,
                                   const GLfloat  theta)
 {
     if (f == NULL) return Vector();
+    Profiler::countFormationSolve();
     GLfloat xn        = c.x + r + X_ROOT_THRESHOLD,
             xn_1      = c.x + r - X_ROOT_THRESHOLD,
             intersect = 0.0f, error = 0.0f;
@@ -0,0 +1,230 @@
+//
+// Filename:        "Formations.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This file implements the formation-testing functions.
+//
+
+// preprocessor directives
+#include <cmath>
+#include <cstdlib>
+#include "Formations.h"
+
+
+
+// the formation-testing functions (by formation index)
+Function  formations[] = {line,        x,       absX,     negHalfX,
+                          negAbsHalfX, negAbsX, parabola, cubic,
+                          condSqrt,    sine,    xRoot3,   negXRoot3};
+const int N_FORMATIONS = sizeof(formations) / sizeof(formations[0]);
+
+
+
+// <test formation functions>
+
+//
+// GLfloat line(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = 0.
+//
+// Returns:     f(x) = 0
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat line(const GLfloat x)
+{
+    return 0.0f;
+}   // line(const GLfloat)
+
+
+
+//
+// GLfloat x(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = x.
+//
+// Returns:     f(x) = x
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat x(const GLfloat x)
+{
+    return x;
+}   // x(const GLfloat)
+
+
+
+//
+// GLfloat absX(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = |x|.
+//
+// Returns:     f(x) = |x|
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat absX(const GLfloat x)
+{
+    return abs(x);
+}   // absX(const GLfloat)
+
+
+
+//
+// GLfloat negHalfX(x)
+// Last modified:   07Jan2007
+//
+// Returns formation function definition f(x) = -0.5 x.
+//
+// Returns:     f(x) = -0.5 x
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat negHalfX(const GLfloat x)
+{
+    return -0.5f * x;
+}   // negHalfX(const GLfloat)
+
+
+
+//
+// GLfloat negAbsHalfX(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = -|0.5 x|.
+//
+// Returns:     f(x) = -|0.5 x|
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat negAbsHalfX(const GLfloat x)
+{
+    return -abs(0.5f * x);
+}   // negAbsHalfX(const GLfloat)
+
+
+
+//
+// GLfloat negAbsX(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = -|x|.
+//
+// Returns:     f(x) = -|x|
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat negAbsX(const GLfloat x)
+{
+    return -abs(x);
+}   // negAbsX(const GLfloat)
+
+
+
+//
+// GLfloat parabola(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = x^2.
+//
+// Returns:     f(x) = x^2
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat parabola(const GLfloat x)
+{
+	return x * x;
+    //return pow(x, 2.0f);
+}   // parabola(const GLfloat)
+
+
+
+//
+// GLfloat cubic(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = x^3.
+//
+// Returns:     f(x) = x^3
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat cubic(const GLfloat x)
+{
+	return x * x * x;
+    //return pow(x, 3.0f);
+}   // cubic(const GLfloat)
+
+
+
+//
+// GLfloat condSqrt(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition
+// f(x) = {sqrt(x),  x = 0 | -sqrt|x|, x < 0}.
+//
+// Returns:     f(x) = {sqrt(x),  x = 0 | -sqrt|x|, x < 0}
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat condSqrt(const GLfloat x)
+{
+    return sqrt(abs(0.5f * x)) * ((x >= 0) ? 1.0f : -1.0f);
+}   // condSqrt(const GLfloat)
+
+
+
+//
+// GLfloat sine(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = 0.05 sin(10 x).
+//
+// Returns:     f(x) = 0.05 sin(10 x)
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat sine(const GLfloat x)
+{
+    //0.1 is max amplitude
+    return 0.1f * sin(10.0f * x);
+}   // sine(const GLfloat)
+
+
+
+//
+// GLfloat xRoot3(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = x sqrt(3).
+//
+// Returns:     f(x) = x sqrt(3)
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat xRoot3(const GLfloat x)
+{
+    return x * sqrt(3.0f);
+}   // xRoot3(const GLfloat)
+
+
+
+//
+// GLfloat negXRoot3(x)
+// Last modified:   04Sep2006
+//
+// Returns formation function definition f(x) = -x sqrt(3).
+//
+// Returns:     f(x) = -x sqrt(3)
+// Parameters:
+//      x       in      used to evaluate the function
+//
+GLfloat negXRoot3(const GLfloat x)
+{
+    return -x * sqrt(3.0f);
+}   // negXRoot3(const GLfloat)
@@ -0,0 +1,38 @@
+//
+// Filename:        "Formations.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This file describes the formation-testing functions
+//                  (the formations the simulator can be told to form).
+//
+
+// preprocessor directives
+#ifndef FORMATIONS_H
+#define FORMATIONS_H
+#include "Formation.h"
+using namespace std;
+
+
+
+// formation-testing function prototypes
+GLfloat  line(const GLfloat x);
+GLfloat  x(const GLfloat x);
+GLfloat  absX(const GLfloat x);
+GLfloat  negHalfX(const GLfloat x);
+GLfloat  negAbsHalfX(const GLfloat x);
+GLfloat  negAbsX(const GLfloat x);
+GLfloat  parabola(const GLfloat x);
+GLfloat  cubic(const GLfloat x);
+GLfloat  condSqrt(const GLfloat x);
+GLfloat  sine(const GLfloat x);
+GLfloat  xRoot3(const GLfloat x);
+GLfloat  negXRoot3(const GLfloat x);
+
+
+
+// the formation-testing functions (by formation index)
+extern Function  formations[];
+extern const int N_FORMATIONS;
+
+#endif
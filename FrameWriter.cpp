@@ -0,0 +1,709 @@
+//
+// Filename:        "FrameWriter.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the frame writer of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include "Environment.h"
+#include "FrameWriter.h"
+
+
+
+// <static data members>
+bool FrameWriter::enabled = false;
+int  FrameWriter::every   = 1;
+
+
+
+// frame writer global variables (the snapshots queued by the simulation
+// form a ring of FRAME_QUEUE_SIZE slots, guarded by g_queueMutex, which
+// the writer thread empties)
+static Snapshot                g_queue[FRAME_QUEUE_SIZE];
+static int                     g_head     = 0;        // the oldest snapshot
+static int                     g_count    = 0;        // snapshots queued
+static bool                    g_stopping = false;
+static mutex                   g_queueMutex;
+static condition_variable      g_notEmpty;
+static condition_variable      g_notFull;
+static thread                  g_writer;
+static string                  g_filename = "";       // (PNG) or stream
+static bool                    g_png      = false;
+static ofstream                g_stream;              // raw RGB24 stream
+static long                    g_nFrames  = 0;        // frames written
+static bool                    g_failed   = false;
+static vector<unsigned char>   g_pixels;              // (r, g, b) of a frame
+
+
+
+// <utility functions>
+
+//
+// unsigned char toByte(c)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized color component [0.0, 1.0] as a byte.
+//
+// Returns:     the color component as a byte
+// Parameters:
+//      c       in      the color component being converted
+//
+static unsigned char toByte(const GLfloat c)
+{
+    if (c <= 0.0f) return 0;
+    if (c >= 1.0f) return 255;
+    return (unsigned char)(c * 255.0f + 0.5f);
+}   // toByte(const GLfloat)
+
+
+
+//
+// void plot(x, y, clr)
+// Last modified: 19Oct2026
+//
+// Sets the parameterized pixel (if in the frame) to the parameterized color.
+//
+// Returns:     <none>
+// Parameters:
+//      x       in      the column of the pixel
+//      y       in      the row of the pixel (from the top)
+//      clr     in      the color of the pixel
+//
+static void plot(const GLint x, const GLint y, const unsigned char clr[3])
+{
+    if ((x < 0) || (x >= FRAME_WIDTH) || (y < 0) || (y >= FRAME_HEIGHT))
+        return;
+    unsigned char *p = &g_pixels[3 * (y * FRAME_WIDTH + x)];
+    p[0] = clr[0];
+    p[1] = clr[1];
+    p[2] = clr[2];
+}   // plot(const GLint, const GLint, const unsigned char [])
+
+
+
+//
+// void toPixel(wx, wy, px, py)
+// Last modified: 19Oct2026
+//
+// Maps the parameterized world coordinates to frame coordinates
+// (the view is [-FRAME_EXTENT, FRAME_EXTENT] in each dimension, as the
+// GUI's, with the y-axis pointing up).
+//
+// Returns:     <none>
+// Parameters:
+//      wx      in      the world x-coordinate
+//      wy      in      the world y-coordinate
+//      px      out     the frame x-coordinate
+//      py      out     the frame y-coordinate
+//
+static void toPixel(const GLdouble wx, const GLdouble wy,
+                    GLdouble &px, GLdouble &py)
+{
+    px = (wx + FRAME_EXTENT) / (2.0 * FRAME_EXTENT) * FRAME_WIDTH;
+    py = (FRAME_EXTENT - wy) / (2.0 * FRAME_EXTENT) * FRAME_HEIGHT;
+}   // toPixel(const GLdouble, const GLdouble, GLdouble &, GLdouble &)
+
+
+
+//
+// void placed(v, theta, dx, dy, x, y, px, py)
+// Last modified: 19Oct2026
+//
+// Maps the parameterized point, in the frame of the parameterized (planar)
+// vector placed at the parameterized position (and rotated by the
+// parameterized angle about the origin), to frame coordinates, i.e.,
+// transforms it as the OpenGL front end does (see GLRenderer.cpp).
+//
+// Returns:     <none>
+// Parameters:
+//      v       in      the vector being placed
+//      theta   in      the rotation about the origin (in degrees)
+//      dx      in      the x-position of the vector
+//      dy      in      the y-position of the vector
+//      x       in      the x-coordinate of the point (of the vector)
+//      y       in      the y-coordinate of the point (of the vector)
+//      px      out     the frame x-coordinate of the point
+//      py      out     the frame y-coordinate of the point
+//
+static void placed(const Vector  &v,  const GLdouble theta,
+                   const GLdouble dx, const GLdouble dy,
+                   const GLdouble x,  const GLdouble y,
+                   GLdouble      &px, GLdouble      &py)
+{
+    GLdouble a  = degreesToRadians(v.angle());
+    GLdouble sx = v.scale[0] * x, sy = v.scale[1] * y;
+    GLdouble wx = cos(a) * sx - sin(a) * sy + dx;
+    GLdouble wy = sin(a) * sx + cos(a) * sy + dy;
+    GLdouble b  = degreesToRadians(theta + v.rotate[2]);
+    toPixel(cos(b) * wx - sin(b) * wy, sin(b) * wx + cos(b) * wy, px, py);
+}   // placed(const Vector &, const GLdouble, ..)
+
+
+
+//
+// void drawLine(x0, y0, x1, y1, clr)
+// Last modified: 19Oct2026
+//
+// Draws a (1-pixel) line segment between the parameterized frame
+// coordinates with the parameterized color (Bresenham's algorithm).
+//
+// Returns:     <none>
+// Parameters:
+//      x0      in      the frame x-coordinate of the first endpoint
+//      y0      in      the frame y-coordinate of the first endpoint
+//      x1      in      the frame x-coordinate of the second endpoint
+//      y1      in      the frame y-coordinate of the second endpoint
+//      clr     in      the color of the line segment
+//
+static void drawLine(const GLdouble x0, const GLdouble y0,
+                     const GLdouble x1, const GLdouble y1,
+                     const unsigned char clr[3])
+{
+    GLint x  = (GLint)floor(x0), y  = (GLint)floor(y0);
+    GLint xn = (GLint)floor(x1), yn = (GLint)floor(y1);
+    GLint dx = abs(xn - x),      dy = -abs(yn - y);
+    GLint sx = (x < xn) ? 1 : -1, sy = (y < yn) ? 1 : -1;
+    GLint err = dx + dy;
+    if ((max(x, xn) < 0) || (min(x, xn) >= FRAME_WIDTH) ||
+        (max(y, yn) < 0) || (min(y, yn) >= FRAME_HEIGHT)) return;
+    while (true)
+    {
+        plot(x, y, clr);
+        if ((x == xn) && (y == yn)) break;
+        GLint e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x   += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y   += sy;
+        }
+    }
+}   // drawLine(const GLdouble, const GLdouble, ..)
+
+
+
+//
+// void fillTriangle(x0, y0, x1, y1, x2, y2, clr)
+// Last modified: 19Oct2026
+//
+// Fills the triangle with the parameterized frame coordinates with the
+// parameterized color (the pixels whose centers it covers).
+//
+// Returns:     <none>
+// Parameters:
+//      x0      in      the frame x-coordinate of the first vertex
+//      y0      in      the frame y-coordinate of the first vertex
+//      x1      in      the frame x-coordinate of the second vertex
+//      y1      in      the frame y-coordinate of the second vertex
+//      x2      in      the frame x-coordinate of the third vertex
+//      y2      in      the frame y-coordinate of the third vertex
+//      clr     in      the color of the triangle
+//
+static void fillTriangle(const GLdouble x0, const GLdouble y0,
+                         const GLdouble x1, const GLdouble y1,
+                         const GLdouble x2, const GLdouble y2,
+                         const unsigned char clr[3])
+{
+    GLdouble area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+    if (area == 0.0) return;
+    GLint xMin = max((GLint)floor(min(x0, min(x1, x2))), 0);
+    GLint xMax = min((GLint)ceil(max(x0, max(x1, x2))), FRAME_WIDTH - 1);
+    GLint yMin = max((GLint)floor(min(y0, min(y1, y2))), 0);
+    GLint yMax = min((GLint)ceil(max(y0, max(y1, y2))), FRAME_HEIGHT - 1);
+    GLdouble s = (area > 0.0) ? 1.0 : -1.0;
+    for (GLint y = yMin; y <= yMax; ++y)
+    {
+        GLdouble py = y + 0.5;
+        for (GLint x = xMin; x <= xMax; ++x)
+        {
+            GLdouble px = x + 0.5;
+            if ((s * ((x1 - x0) * (py - y0) - (px - x0) * (y1 - y0)) >= 0.0) &&
+                (s * ((x2 - x1) * (py - y1) - (px - x1) * (y2 - y1)) >= 0.0) &&
+                (s * ((x0 - x2) * (py - y2) - (px - x2) * (y0 - y2)) >= 0.0))
+                plot(x, y, clr);
+        }
+    }
+}   // fillTriangle(const GLdouble, const GLdouble, ..)
+
+
+
+//
+// void drawVector(v, theta)
+// Last modified: 19Oct2026
+//
+// Draws the parameterized (planar) vector, rotated by the parameterized
+// angle about the origin, as a line segment with a triangle head.
+//
+// Returns:     <none>
+// Parameters:
+//      v       in      the vector being drawn
+//      theta   in      the rotation about the origin (in degrees)
+//
+static void drawVector(const Vector &v, const GLdouble theta = 0.0)
+{
+    unsigned char clr[3] = {toByte(v.color[RED_COMPONENT]),
+                            toByte(v.color[GREEN_COMPONENT]),
+                            toByte(v.color[BLUE_COMPONENT])};
+    GLdouble mag = v.magnitude(), dx = v.translate[0], dy = v.translate[1];
+    GLdouble x0, y0, x1, y1, x2, y2;
+
+    // draw vector head
+    if ((v.showHead) && (mag >= VECTOR_HEAD_HEIGHT))
+    {
+        placed(v, theta, dx, dy, mag, 0.0, x0, y0);
+        placed(v, theta, dx, dy, mag - VECTOR_HEAD_HEIGHT,
+               VECTOR_HEAD_WIDTH,  x1, y1);
+        placed(v, theta, dx, dy, mag - VECTOR_HEAD_HEIGHT,
+               -VECTOR_HEAD_WIDTH, x2, y2);
+        fillTriangle(x0, y0, x1, y1, x2, y2, clr);
+    }
+
+    // draw vector line
+    if (v.showLine)
+    {
+        placed(v, theta, dx, dy, 0.0, 0.0, x0, y0);
+        placed(v, theta, dx, dy, mag, 0.0, x1, y1);
+        drawLine(x0, y0, x1, y1, clr);
+    }
+}   // drawVector(const Vector &, const GLdouble)
+
+
+
+//
+// void drawCircle(c)
+// Last modified: 19Oct2026
+//
+// Draws the parameterized (planar) circle with its vector position and
+// radius as a polygon (as the OpenGL front end does).
+//
+// Returns:     <none>
+// Parameters:
+//      c       in      the circle being drawn
+//
+static void drawCircle(const Circle &c)
+{
+    unsigned char clr[3] = {toByte(c.color[RED_COMPONENT]),
+                            toByte(c.color[GREEN_COMPONENT]),
+                            toByte(c.color[BLUE_COMPONENT])};
+
+    // draw vector position
+    if (c.showPos) drawVector(c);
+
+    // draw each edge of the polygonal approximation to the circle
+    GLdouble cx = c.x + c.translate[0], cy = c.y + c.translate[1];
+    GLdouble ox, oy, x0, y0, x1, y1;
+    GLfloat  dx = c.getRadius(), dy = 0.0f, tx = 0.0f, ty = 0.0f;
+    placed(c, 0.0, cx, cy, 0.0, 0.0, ox, oy);
+    placed(c, 0.0, cx, cy, dx,  dy,  x0, y0);
+    for (GLint i = 0; i < CIRCLE_N_LINKS; ++i)
+    {
+        tx  = -dy;
+        ty  =  dx;
+        dx += tx * CIRCLE_TAN_THETA;
+        dy += ty * CIRCLE_TAN_THETA;
+        dx *= CIRCLE_COS_THETA;
+        dy *= CIRCLE_COS_THETA;
+        placed(c, 0.0, cx, cy, dx, dy, x1, y1);
+        if (c.showFilled) fillTriangle(ox, oy, x0, y0, x1, y1, clr);
+        else              drawLine(x0, y0, x1, y1, clr);
+        x0 = x1;
+        y0 = y1;
+    }
+}   // drawCircle(const Circle &)
+
+
+
+//
+// void rasterize(s)
+// Last modified: 19Oct2026
+//
+// Rasterizes the parameterized snapshot into the frame.
+//
+// Returns:     <none>
+// Parameters:
+//      s       in      the snapshot being rasterized
+//
+static void rasterize(const Snapshot &s)
+{
+    unsigned char bg[3] = {toByte(s.color[RED_COMPONENT]),
+                           toByte(s.color[GREEN_COMPONENT]),
+                           toByte(s.color[BLUE_COMPONENT])};
+    g_pixels.resize(3 * FRAME_WIDTH * FRAME_HEIGHT);
+    for (size_t i = 0; i < g_pixels.size(); i += 3)
+    {
+        g_pixels[i]     = bg[0];
+        g_pixels[i + 1] = bg[1];
+        g_pixels[i + 2] = bg[2];
+    }
+    for (size_t i = 0; i < s.robots.size(); ++i)
+    {
+        const RobotSnapshot &r = s.robots[i];
+        if ((r.body.color[RED_COMPONENT]   == COLOR[INVISIBLE][RED_COMPONENT])   &&
+            (r.body.color[GREEN_COMPONENT] == COLOR[INVISIBLE][GREEN_COMPONENT]) &&
+            (r.body.color[BLUE_COMPONENT]  == COLOR[INVISIBLE][BLUE_COMPONENT]))
+            continue;
+        drawCircle(r.body);
+        if (r.showHeading)
+            drawVector(r.heading, r.body.rotate[0] + r.body.rotate[1] +
+                                  r.body.rotate[2]);
+    }
+}   // rasterize(const Snapshot &)
+
+
+
+//
+// unsigned long crc32(crc, data, n)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized CRC-32 (of PNG chunks) updated with the
+// parameterized data.
+//
+// Returns:     the updated CRC-32
+// Parameters:
+//      crc     in      the CRC-32 being updated (0 initially)
+//      data    in      the data being added
+//      n       in      the number of bytes of data
+//
+static unsigned long crc32(unsigned long crc, const unsigned char *data,
+                           const size_t n)
+{
+    static unsigned long table[256];
+    static bool          computed = false;
+    if (!computed)
+    {
+        for (unsigned long i = 0; i < 256; ++i)
+        {
+            unsigned long c = i;
+            for (GLint k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xedb88320UL ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        computed = true;
+    }
+    crc ^= 0xffffffffUL;
+    for (size_t i = 0; i < n; ++i)
+        crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffUL;
+}   // crc32(unsigned long, const unsigned char *, const size_t)
+
+
+
+//
+// void putUint32(buf, value)
+// Last modified: 19Oct2026
+//
+// Appends the parameterized value (big-endian) to the parameterized buffer.
+//
+// Returns:     <none>
+// Parameters:
+//      buf     in/out  the buffer being appended to
+//      value   in      the value being appended
+//
+static void putUint32(vector<unsigned char> &buf, const unsigned long value)
+{
+    buf.push_back((unsigned char)((value >> 24) & 0xff));
+    buf.push_back((unsigned char)((value >> 16) & 0xff));
+    buf.push_back((unsigned char)((value >>  8) & 0xff));
+    buf.push_back((unsigned char)( value        & 0xff));
+}   // putUint32(vector<unsigned char> &, const unsigned long)
+
+
+
+//
+// void writeChunk(os, type, data)
+// Last modified: 19Oct2026
+//
+// Writes a PNG chunk of the parameterized type and data.
+//
+// Returns:     <none>
+// Parameters:
+//      os      in/out  the stream being written to
+//      type    in      the (4-character) type of the chunk
+//      data    in      the data of the chunk
+//
+static void writeChunk(ostream &os, const char *type,
+                       const vector<unsigned char> &data)
+{
+    vector<unsigned char> chunk;
+    putUint32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    putUint32(chunk, crc32(0, &chunk[4], chunk.size() - 4));
+    os.write((const char *)&chunk[0], chunk.size());
+}   // writeChunk(ostream &, const char *, const vector<unsigned char> &)
+
+
+
+//
+// bool writePng(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to write the frame as a PNG file (stored, i.e., with
+// uncompressed deflate blocks, so no compression library is needed),
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the PNG file
+//
+static bool writePng(const string &filename)
+{
+    static const unsigned char SIGNATURE[8] = {137, 'P', 'N', 'G',
+                                               '\r', '\n', 26, '\n'};
+    static const size_t        MAX_BLOCK    = 65535;
+    ofstream os(filename.c_str(), ios::binary);
+    if (!os) return false;
+    os.write((const char *)SIGNATURE, 8);
+
+    // write the header (8-bit RGB)
+    vector<unsigned char> header;
+    putUint32(header, FRAME_WIDTH);
+    putUint32(header, FRAME_HEIGHT);
+    header.push_back(8);
+    header.push_back(2);
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+    writeChunk(os, "IHDR", header);
+
+    // write the rows (unfiltered) as a zlib stream of stored blocks
+    size_t rowSize = 1 + 3 * FRAME_WIDTH, n = rowSize * FRAME_HEIGHT;
+    vector<unsigned char> raw(n), data;
+    for (GLint y = 0; y < FRAME_HEIGHT; ++y)
+    {
+        raw[y * rowSize] = 0;
+        copy(&g_pixels[3 * y * FRAME_WIDTH],
+             &g_pixels[3 * (y + 1) * FRAME_WIDTH],
+             &raw[y * rowSize + 1]);
+    }
+    data.reserve(n + 6 + 5 * (n / MAX_BLOCK + 1));
+    data.push_back(0x78);
+    data.push_back(0x01);
+    for (size_t i = 0; i < n; i += MAX_BLOCK)
+    {
+        size_t len = min(MAX_BLOCK, n - i);
+        data.push_back((i + len == n) ? 1 : 0);
+        data.push_back((unsigned char)( len       & 0xff));
+        data.push_back((unsigned char)((len >> 8) & 0xff));
+        data.push_back((unsigned char)( ~len       & 0xff));
+        data.push_back((unsigned char)((~len >> 8) & 0xff));
+        data.insert(data.end(), raw.begin() + i, raw.begin() + i + len);
+    }
+    unsigned long a = 1, b = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a)      % 65521;
+    }
+    putUint32(data, (b << 16) | a);
+    writeChunk(os, "IDAT", data);
+    writeChunk(os, "IEND", vector<unsigned char>());
+    return os.good();
+}   // writePng(const string &)
+
+
+
+//
+// void writeFrames()
+// Last modified: 19Oct2026
+//
+// Rasterizes and writes the queued snapshots until the frame writer
+// is closed (run by the writer thread).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+static void writeFrames()
+{
+    Snapshot s;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(g_queueMutex);
+            while ((g_count == 0) && (!g_stopping)) g_notEmpty.wait(lock);
+            if (g_count == 0) return;
+            swap(s, g_queue[g_head]);
+            g_head = (g_head + 1) % FRAME_QUEUE_SIZE;
+            --g_count;
+        }
+        g_notFull.notify_one();
+
+        rasterize(s);
+        bool success;
+        if (g_png)
+        {
+            char filename[1024];
+            snprintf(filename, sizeof(filename), g_filename.c_str(),
+                     (int)g_nFrames);
+            success = writePng(filename);
+        }
+        else
+        {
+            g_stream.write((const char *)&g_pixels[0], g_pixels.size());
+            success = g_stream.good();
+        }
+        if (!success) g_failed = true;
+        ++g_nFrames;
+    }
+}   // writeFrames()
+
+
+
+//
+// int countConversions(format)
+// Last modified: 19Oct2026
+//
+// Returns the number of integer conversions (e.g., "%05d") in the
+// parameterized printf-style format, or -1 if it has any other conversion.
+//
+// Returns:     the number of integer conversions (-1 = other conversions)
+// Parameters:
+//      format  in      the format being checked
+//
+static int countConversions(const string &format)
+{
+    int n = 0;
+    for (size_t i = 0; i < format.size(); ++i)
+    {
+        if (format[i] != '%') continue;
+        if ((++i < format.size()) && (format[i] == '%')) continue;
+        i = format.find_first_not_of("-+ #0", i);
+        i = format.find_first_not_of("0123456789", i);
+        if ((i == string::npos) || ((format[i] != 'd') && (format[i] != 'i')))
+            return -1;
+        ++n;
+    }
+    return n;
+}   // countConversions(const string &)
+
+
+
+// <public static mutator functions>
+
+//
+// bool open(filename, every)
+// Last modified: 19Oct2026
+//
+// Attempts to start writing a frame every (parameterized) number of steps
+// to the parameterized file(s) (a PNG filename may number its frames with
+// at most one integer conversion), returning true if successful, false
+// otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the frame file(s)
+//      every       in      the number of steps between frames
+//
+bool FrameWriter::open(const string &filename, const int every)
+{
+    if (enabled) close();
+    if (every <= 0) return false;
+    string ext = (filename.size() >= 4) ?
+                 filename.substr(filename.size() - 4) : "";
+    g_png      = (ext == ".png") || (ext == ".PNG");
+    g_filename = filename;
+    if (g_png)
+    {
+        int n = countConversions(filename);
+        if ((n < 0) || (n > 1)) return false;
+        if (n == 0) g_filename.insert(g_filename.size() - 4, "_%05d");
+    }
+    else
+    {
+        g_stream.open(filename.c_str(), ios::binary);
+        if (!g_stream) return false;
+    }
+    FrameWriter::every = every;
+    g_head     = g_count = 0;
+    g_stopping = false;
+    g_failed   = false;
+    g_nFrames  = 0;
+    g_writer   = thread(writeFrames);
+    enabled    = true;
+    return true;
+}   // open(const string &, const int)
+
+
+
+//
+// bool close()
+// Last modified: 19Oct2026
+//
+// Attempts to finish writing the queued frames, returning true if
+// successful (every frame was written), false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool FrameWriter::close()
+{
+    if (!enabled) return false;
+    enabled = false;
+    {
+        lock_guard<mutex> lock(g_queueMutex);
+        g_stopping = true;
+    }
+    g_notEmpty.notify_one();
+    g_writer.join();
+    if (g_stream.is_open())
+    {
+        g_stream.close();
+        if (g_stream.fail()) g_failed = true;
+    }
+    return !g_failed;
+}   // close()
+
+
+
+//
+// void capture(env)
+// Last modified: 19Oct2026
+//
+// Queues a snapshot of the parameterized environment for the writer
+// thread if a frame is due at its step (waiting while the queue is full).
+//
+// Returns:     <none>
+// Parameters:
+//      env     in/out  the environment being captured
+//
+void FrameWriter::capture(Environment *env)
+{
+    if ((!enabled) || (env == NULL) || (env->stepCount % every != 0)) return;
+    {
+        unique_lock<mutex> lock(g_queueMutex);
+        while (g_count == FRAME_QUEUE_SIZE) g_notFull.wait(lock);
+        env->capture(g_queue[(g_head + g_count) % FRAME_QUEUE_SIZE]);
+        ++g_count;
+    }
+    g_notEmpty.notify_one();
+}   // capture(Environment *)
+
+
+
+// <public static accessor functions>
+
+//
+// long getNFrames()
+// Last modified: 19Oct2026
+//
+// Returns the number of frames written.
+//
+// Returns:     the number of frames written
+// Parameters:  <none>
+//
+long FrameWriter::getNFrames()
+{
+    return g_nFrames;
+}   // getNFrames()
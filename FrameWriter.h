@@ -0,0 +1,67 @@
+//
+// Filename:        "FrameWriter.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the frame writer of the simulation,
+//                  which renders frames of a run without a display (or
+//                  OpenGL).  Every few steps, a snapshot of the environment
+//                  is queued for a background thread, which rasterizes its
+//                  robots (circles and headings, as the GUI renders them)
+//                  and writes the frame either as a PNG file (when the
+//                  filename ends in ".png", numbered by a single
+//                  printf-style "%d" in the filename, or after it) or
+//                  appended to a raw RGB24 video stream (otherwise), e.g.,
+//                  for
+//
+//                      ffmpeg -f rawvideo -pix_fmt rgb24 -s 800x800
+//                             -r 30 -i frames.rgb frames.mp4
+//
+//                  The simulation waits only if FRAME_QUEUE_SIZE frames
+//                  are already queued.
+//
+
+// preprocessor directives
+#ifndef FRAME_WRITER_H
+#define FRAME_WRITER_H
+#include <string>
+using namespace std;
+
+
+
+// frame writer settings
+#define FRAME_WIDTH        (800)     // in pixels (as the GUI window)
+#define FRAME_HEIGHT       (800)
+#define FRAME_EXTENT       (1.0f)    // half the width of the view
+#define FRAME_QUEUE_SIZE   (4)       // snapshots queued for the writer
+
+
+
+// forward declaration of a robot cell environment
+class Environment;
+
+
+
+// describes the (process-wide) frame writer
+class FrameWriter
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static bool open(const string &filename, const int every = 1);
+        static bool close();
+        static void capture(Environment *env);
+
+        // <public static accessor functions>
+        static long getNFrames();
+
+    protected:
+
+        // <protected static data members>
+        static int every;    // steps between frames
+};  // FrameWriter
+
+#endif
@@ -0,0 +1,688 @@
+//
+// Filename:        "GLRenderer.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the OpenGL front end of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include "Environment.h"
+#include "GLIncludes.h"
+#include "GLRenderer.h"
+
+
+
+// describes a 2-dimensional affine transformation, i.e., the part of the
+// modelview matrix built by the rotations (about the z-axis), translations,
+// and scalings of a drawn object (x' = a x + c y + tx, y' = b x + d y + ty)
+struct Affine
+{
+    GLdouble a, b, c, d, tx, ty;
+};  // Affine
+
+static const Affine IDENTITY = {1.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+
+
+
+// <utility functions>
+
+//
+// bool isInvisible(clr)
+// Last modified: 19Oct2026
+//
+// Returns true if the parameterized color is invisible, false otherwise.
+//
+// Returns:     true if the color is invisible, false otherwise
+// Parameters:
+//      clr     in      the color being checked
+//
+static bool isInvisible(const GLfloat clr[3])
+{
+    return (clr[GLUT_RED]   == COLOR[INVISIBLE][GLUT_RED])   &&
+           (clr[GLUT_GREEN] == COLOR[INVISIBLE][GLUT_GREEN]) &&
+           (clr[GLUT_BLUE]  == COLOR[INVISIBLE][GLUT_BLUE]);
+}   // isInvisible(const GLfloat [])
+
+
+
+//
+// bool isPlanar(v)
+// Last modified: 19Oct2026
+//
+// Returns true if the parameterized vector is drawn in the xy-plane
+// (i.e., is not rotated about the x- or y-axis, and so can be batched),
+// false otherwise.
+//
+// Returns:     true if the vector is drawn in the xy-plane, false otherwise
+// Parameters:
+//      v       in      the vector being checked
+//
+static bool isPlanar(const Vector &v)
+{
+    return (v.rotate[0] == 0.0f) && (v.rotate[1] == 0.0f);
+}   // isPlanar(const Vector &)
+
+
+
+//
+// Affine multiply(m, n)
+// Last modified: 19Oct2026
+//
+// Returns the product of the parameterized transformations
+// (n applied first, as with successive OpenGL transformations).
+//
+// Returns:     the product of the transformations
+// Parameters:
+//      m       in      the transformation applied last
+//      n       in      the transformation applied first
+//
+static Affine multiply(const Affine &m, const Affine &n)
+{
+    Affine r;
+    r.a  = m.a * n.a  + m.c * n.b;
+    r.b  = m.b * n.a  + m.d * n.b;
+    r.c  = m.a * n.c  + m.c * n.d;
+    r.d  = m.b * n.c  + m.d * n.d;
+    r.tx = m.a * n.tx + m.c * n.ty + m.tx;
+    r.ty = m.b * n.tx + m.d * n.ty + m.ty;
+    return r;
+}   // multiply(const Affine &, const Affine &)
+
+
+
+//
+// Affine rotated(m, theta)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized transformation followed (as with glRotated)
+// by a rotation about the z-axis.
+//
+// Returns:     the rotated transformation
+// Parameters:
+//      m       in      the transformation being rotated
+//      theta   in      the rotation (in degrees)
+//
+static Affine rotated(const Affine &m, const GLdouble theta)
+{
+    GLdouble rad = degreesToRadians(theta);
+    Affine   r   = {cos(rad), sin(rad), -sin(rad), cos(rad), 0.0, 0.0};
+    return multiply(m, r);
+}   // rotated(const Affine &, const GLdouble)
+
+
+
+//
+// Affine placed(m, v)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized transformation followed by the transformations
+// that place the parameterized (planar) vector, i.e., its rotation,
+// translation to the parameterized position, rotation to its angle, and
+// scaling.
+//
+// Returns:     the transformation of the vector
+// Parameters:
+//      m       in      the transformation being followed
+//      v       in      the vector being placed
+//      dx      in      the x-position of the vector
+//      dy      in      the y-position of the vector
+//
+static Affine placed(const Affine &m, const Vector &v,
+                     const GLdouble dx, const GLdouble dy)
+{
+    Affine t = {1.0, 0.0, 0.0, 1.0, dx, dy};
+    Affine s = {v.scale[0], 0.0, 0.0, v.scale[1], 0.0, 0.0};
+    return multiply(rotated(multiply(rotated(m, v.rotate[2]), t), v.angle()),
+                    s);
+}   // placed(const Affine &, const Vector &, const GLdouble, const GLdouble)
+
+
+
+//
+// void addVertex(verts, colors, m, x, y, clr)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized vertex (transformed) with the parameterized color
+// to the parameterized vertex and color arrays.
+//
+// Returns:     <none>
+// Parameters:
+//      verts   in/out  the vertex array being added to
+//      colors  in/out  the color array being added to
+//      m       in      the transformation of the vertex
+//      x       in      the x-coordinate of the vertex
+//      y       in      the y-coordinate of the vertex
+//      clr     in      the color of the vertex
+//
+static void addVertex(vector<GLfloat> &verts, vector<GLfloat> &colors,
+                      const Affine &m, const GLdouble x, const GLdouble y,
+                      const GLfloat clr[3])
+{
+    verts.push_back((GLfloat)(m.a * x + m.c * y + m.tx));
+    verts.push_back((GLfloat)(m.b * x + m.d * y + m.ty));
+    colors.insert(colors.end(), clr, clr + 3);
+}   // addVertex(vector<GLfloat> &, vector<GLfloat> &, ..)
+
+
+
+//
+// const GLfloat* unitCircle()
+// Last modified: 19Oct2026
+//
+// Returns the (CIRCLE_N_LINKS + 1) vertices of the polygonal approximation
+// to the unit circle (as (x, y) pairs, computed once).
+//
+// Returns:     the vertices of the unit circle
+// Parameters:  <none>
+//
+static const GLfloat* unitCircle()
+{
+    static GLfloat vertices[2 * (CIRCLE_N_LINKS + 1)];
+    static bool    computed = false;
+    if (!computed)
+    {
+        GLfloat dx = 1.0f, dy = 0.0f, tx = 0.0f, ty = 0.0f;
+        for (GLint i = 0; i <= CIRCLE_N_LINKS; ++i)
+        {
+            vertices[2 * i]     = dx;
+            vertices[2 * i + 1] = dy;
+            tx  = -dy;
+            ty  =  dx;
+            dx += tx * CIRCLE_TAN_THETA;
+            dy += ty * CIRCLE_TAN_THETA;
+            dx *= CIRCLE_COS_THETA;
+            dy *= CIRCLE_COS_THETA;
+        }
+        computed = true;
+    }
+    return vertices;
+}   // unitCircle()
+
+
+
+// <constructors>
+
+//
+// GLRenderer()
+// Last modified: 19Oct2026
+//
+// Default constructor that initializes this renderer (not batching,
+// with the initial view of the simulator window).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+GLRenderer::GLRenderer(): batching(false)
+{
+    setView(-1.0, 1.0, -1.0, 1.0, 800, 800);
+}   // GLRenderer()
+
+
+
+// <public mutator functions>
+
+//
+// void beginFrame()
+// Last modified: 19Oct2026
+//
+// Begins a frame, batching the objects drawn until the frame ends.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void GLRenderer::beginFrame()
+{
+    triangles.clear();
+    triangleColors.clear();
+    lines.clear();
+    lineColors.clear();
+    points.clear();
+    pointColors.clear();
+    batching = true;
+}   // beginFrame()
+
+
+
+//
+// void endFrame()
+// Last modified: 19Oct2026
+//
+// Ends a frame, drawing the objects batched (the triangles, the lines,
+// then the points, with a draw call each).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void GLRenderer::endFrame()
+{
+    batching = false;
+    glLineWidth(VECTOR_LINE_WIDTH);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    if (!triangles.empty())
+    {
+        glVertexPointer(2, GL_FLOAT, 0, &triangles[0]);
+        glColorPointer(3, GL_FLOAT, 0, &triangleColors[0]);
+        glDrawArrays(GL_TRIANGLES, 0, triangles.size() / 2);
+    }
+    if (!lines.empty())
+    {
+        glVertexPointer(2, GL_FLOAT, 0, &lines[0]);
+        glColorPointer(3, GL_FLOAT, 0, &lineColors[0]);
+        glDrawArrays(GL_LINES, 0, lines.size() / 2);
+    }
+    if (!points.empty())
+    {
+        glPointSize(2.0f * LOD_POINT_RADIUS);
+        glVertexPointer(2, GL_FLOAT, 0, &points[0]);
+        glColorPointer(3, GL_FLOAT, 0, &pointColors[0]);
+        glDrawArrays(GL_POINTS, 0, points.size() / 2);
+    }
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+}   // endFrame()
+
+
+
+//
+// void setView(left, right, bottom, top, width, height)
+// Last modified: 19Oct2026
+//
+// Sets the view (the orthographic projection of the window) that drawn
+// snapshots are culled to and whose scale chooses their level of detail.
+//
+// Returns:     <none>
+// Parameters:
+//      left    in      the left edge of the view
+//      right   in      the right edge of the view
+//      bottom  in      the bottom edge of the view
+//      top     in      the top edge of the view
+//      width   in      the width of the window (in pixels)
+//      height  in      the height of the window (in pixels)
+//
+void GLRenderer::setView(const GLdouble left,   const GLdouble right,
+                         const GLdouble bottom, const GLdouble top,
+                         const GLint    width,  const GLint    height)
+{
+    view[0]       = left;
+    view[1]       = right;
+    view[2]       = bottom;
+    view[3]       = top;
+    pixelsPerUnit = min(width / (right - left), height / (top - bottom));
+}   // setView(const GLdouble, const GLdouble, ..)
+
+
+
+// <virtual public utility functions>
+
+//
+// void drawVector(v)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized vector as a line segment with a triangle head
+// (batched if in a frame).
+//
+// Returns:     <none>
+// Parameters:
+//      v       in/out  the vector being rendered
+//
+void GLRenderer::drawVector(Vector &v)
+{
+    if (isInvisible(v.color)) return;
+    if ((!batching) || (!isPlanar(v)))
+    {
+        drawVectorImmediate(v);
+        return;
+    }
+    batchVector(IDENTITY, v);
+}   // drawVector(Vector &)
+
+
+
+//
+// void drawCircle(c)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized circle with its vector position and radius
+// (batched if in a frame).
+//
+// Returns:     <none>
+// Parameters:
+//      c       in/out  the circle being rendered
+//
+void GLRenderer::drawCircle(Circle &c)
+{
+    if (isInvisible(c.color)) return;
+    if ((!batching) || (!isPlanar(c)))
+    {
+        drawCircleImmediate(c);
+        return;
+    }
+    batchCircle(c);
+}   // drawCircle(Circle &)
+
+
+
+//
+// void drawRobot(r)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized robot as a circle with a vector heading
+// (batched if in a frame).
+//
+// Returns:     <none>
+// Parameters:
+//      r       in/out  the robot being rendered
+//
+void GLRenderer::drawRobot(Robot &r)
+{
+    if (isInvisible(r.color)) return;
+
+    // draw a circle representing the robot
+    drawCircle(r);
+
+    // draw a vector representing the robot heading
+    if (r.showHeading)
+    {
+        r.heading.translated(r.x + r.translate[0],
+                             r.y + r.translate[1],
+                             r.z + r.translate[2]);
+        r.heading.scaled(r.getRadius() / DEFAULT_ROBOT_RADIUS);
+        r.heading.setColor(r.color);
+        drawHeading(r, r.heading);
+    }
+}   // drawRobot(Robot &)
+
+
+
+//
+// void drawSnapshot(s)
+// Last modified: 19Oct2026
+//
+// Renders the robots of the parameterized snapshot (see Snapshot.h)
+// as they were rendered at its step, culling those outside the view and
+// choosing the level of detail of the others by their on-screen size
+// (if in a frame).
+//
+// Returns:     <none>
+// Parameters:
+//      s       in/out  the snapshot being rendered
+//
+void GLRenderer::drawSnapshot(Snapshot &s)
+{
+    for (size_t i = 0; i < s.robots.size(); ++i)
+    {
+        RobotSnapshot &r = s.robots[i];
+        if (isInvisible(r.body.color)) continue;
+        if ((!batching) || (!isPlanar(r.body)) || (r.body.showPos))
+        {
+            drawCircle(r.body);
+            if (r.showHeading) drawHeading(r.body, r.heading);
+            continue;
+        }
+
+        // cull the robot (and its heading) if outside the view
+        Affine   m       = placed(IDENTITY, r.body,
+                                  r.body.x + r.body.translate[0],
+                                  r.body.y + r.body.translate[1]);
+        GLdouble radius  = r.body.getRadius() *
+                           max(fabs(r.body.scale[0]), fabs(r.body.scale[1]));
+        GLdouble heading = r.showHeading ?
+                           r.heading.magnitude() * fabs(r.heading.scale[0]) :
+                           0.0;
+        GLdouble extent  = max(radius, heading);
+        if ((m.tx + extent < view[0]) || (m.tx - extent > view[1]) ||
+            (m.ty + extent < view[2]) || (m.ty - extent > view[3])) continue;
+
+        // draw the robot at the level of detail of its on-screen size
+        if (radius * pixelsPerUnit < LOD_POINT_RADIUS)
+        {
+            addVertex(points, pointColors, m, 0.0, 0.0, r.body.color);
+            continue;
+        }
+        batchCircle(r.body, (radius * pixelsPerUnit < LOD_LOW_RADIUS) ?
+                            LOD_LOW_STRIDE : 1);
+        if ((r.showHeading) &&
+            (heading * pixelsPerUnit >= LOD_HEADING_LENGTH))
+            drawHeading(r.body, r.heading);
+    }
+}   // drawSnapshot(Snapshot &)
+
+
+
+// <protected utility functions>
+
+//
+// void batchCircle(c, stride)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized (planar) circle with its vector position and
+// radius to the batch as a polygon of every (parameterized) stride-th
+// vertex of the polygonal approximation to the circle.
+//
+// Returns:     <none>
+// Parameters:
+//      c       in      the circle being added
+//      stride  in      the stride of the vertices (1 = full detail)
+//
+void GLRenderer::batchCircle(const Circle &c, const GLint stride)
+{
+
+    // add vector position
+    if (c.showPos) batchVector(IDENTITY, c);
+
+    // add each edge of the polygonal approximation to the circle
+    Affine         m = placed(IDENTITY, c, c.x + c.translate[0],
+                                           c.y + c.translate[1]);
+    GLdouble       r = c.getRadius();
+    const GLfloat *p = unitCircle();
+    for (GLint i = 0; i < CIRCLE_N_LINKS; i += stride)
+    {
+        GLint j = 2 * i, k = 2 * min(i + stride, CIRCLE_N_LINKS);
+        if (c.showFilled)
+        {
+            addVertex(triangles, triangleColors, m, 0.0, 0.0, c.color);
+            addVertex(triangles, triangleColors, m, r * p[j], r * p[j + 1],
+                      c.color);
+            addVertex(triangles, triangleColors, m, r * p[k], r * p[k + 1],
+                      c.color);
+        }
+        else
+        {
+            addVertex(lines, lineColors, m, r * p[j], r * p[j + 1], c.color);
+            addVertex(lines, lineColors, m, r * p[k], r * p[k + 1], c.color);
+        }
+    }
+    if (!c.showFilled)    // close the loop
+    {
+        GLint k = 2 * CIRCLE_N_LINKS;
+        addVertex(lines, lineColors, m, r * p[k], r * p[k + 1], c.color);
+        addVertex(lines, lineColors, m, r * p[0], r * p[1],     c.color);
+    }
+}   // batchCircle(const Circle &, const GLint)
+
+
+
+//
+// void drawHeading(body, heading)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized heading (placed on the parameterized body)
+// as a vector, rotated as the body is (batched if in a frame).
+//
+// Returns:     <none>
+// Parameters:
+//      body    in      the body of the robot
+//      heading in/out  the heading of the robot
+//
+void GLRenderer::drawHeading(const Circle &body, Vector &heading)
+{
+    if ((batching) && (isPlanar(heading)))
+    {
+        batchVector(rotated(IDENTITY,
+                            body.rotate[0] + body.rotate[1] + body.rotate[2]),
+                    heading);
+        return;
+    }
+    glPushMatrix();
+        glRotated(body.rotate[0], 0, 0, 1);
+        glRotated(body.rotate[1], 0, 0, 1);
+        glRotated(body.rotate[2], 0, 0, 1);
+        drawVectorImmediate(heading);
+    glPopMatrix();
+}   // drawHeading(const Circle &, Vector &)
+
+
+
+//
+// void batchVector(m, v)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized (planar) vector, transformed by the parameterized
+// transformation, to the batch as a line segment with a triangle head.
+//
+// Returns:     <none>
+// Parameters:
+//      m       in      the transformation of the vector
+//      v       in      the vector being added
+//
+void GLRenderer::batchVector(const Affine &m, const Vector &v)
+{
+    Affine   t   = placed(m, v, v.translate[0], v.translate[1]);
+    GLdouble mag = v.magnitude();
+
+    // add vector head
+    if ((v.showHead) && (mag >= VECTOR_HEAD_HEIGHT))
+    {
+        addVertex(triangles, triangleColors, t, mag, 0.0, v.color);
+        addVertex(triangles, triangleColors, t, mag - VECTOR_HEAD_HEIGHT,
+                  VECTOR_HEAD_WIDTH, v.color);
+        addVertex(triangles, triangleColors, t, mag - VECTOR_HEAD_HEIGHT,
+                  -VECTOR_HEAD_WIDTH, v.color);
+    }
+
+    // add vector line
+    if (v.showLine)
+    {
+        addVertex(lines, lineColors, t, 0.0, 0.0, v.color);
+        addVertex(lines, lineColors, t, mag, 0.0, v.color);
+    }
+}   // batchVector(const Affine &, const Vector &)
+
+
+
+//
+// void drawVectorImmediate(v)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized vector as a line segment with a triangle head
+// in immediate mode.
+//
+// Returns:     <none>
+// Parameters:
+//      v       in/out  the vector being rendered
+//
+void GLRenderer::drawVectorImmediate(Vector &v)
+{
+    glColor3fv(v.color);
+    glLineWidth(VECTOR_LINE_WIDTH);
+
+    glPushMatrix();
+        glRotated(v.rotate[0], 1, 0, 0);
+        glRotated(v.rotate[1], 0, 1, 0);
+        glRotated(v.rotate[2], 0, 0, 1);
+        glTranslated(v.translate[0], v.translate[1], v.translate[2]);
+        glRotated(v.angle(),   0, 0, 1);
+        glScaled(v.scale[0], v.scale[1], v.scale[2]);
+
+        // draw vector head
+        GLfloat mag = v.magnitude();
+        if ((v.showHead) && (mag >= VECTOR_HEAD_HEIGHT))
+        {
+            glColor3fv(v.color);
+            glBegin(GL_TRIANGLES);
+                glVertex3f(mag, 0.0f, 0.0f);
+                glVertex3f(mag - VECTOR_HEAD_HEIGHT,
+                           VECTOR_HEAD_WIDTH,
+                           0.0f);
+                glVertex3f(mag - VECTOR_HEAD_HEIGHT,
+                           -VECTOR_HEAD_WIDTH,
+                           0.0f);
+            glEnd();
+        }
+
+        // draw vector line
+        if (v.showLine)
+        {
+            glBegin(GL_LINES);
+                glVertex3f(0.0f,      0.0f, 0.0f);
+                glVertex3f(mag, 0.0f, 0.0f);
+            glEnd();
+        }
+    glPopMatrix();
+}   // drawVectorImmediate(Vector &)
+
+
+
+//
+// void drawCircleImmediate(c)
+// Last modified: 19Oct2026
+//
+// Renders the parameterized circle with its vector position and radius
+// in immediate mode.
+//
+// Returns:     <none>
+// Parameters:
+//      c       in/out  the circle being rendered
+//
+void GLRenderer::drawCircleImmediate(Circle &c)
+{
+    glColor3fv(c.color);
+    glLineWidth(VECTOR_LINE_WIDTH);
+
+    // draw vector position
+    if (c.showPos) drawVectorImmediate(c);
+
+    // draw a polygonal approximation to the circle
+    glPushMatrix();
+        glRotated(c.rotate[0], 1, 0, 0);
+        glRotated(c.rotate[1], 0, 1, 0);
+        glRotated(c.rotate[2], 0, 0, 1);
+        glTranslated(c.x + c.translate[0],
+                     c.y + c.translate[1],
+                     c.z + c.translate[2]);
+        glRotated(c.angle(), 0, 0, 1);
+        glScaled(c.scale[0], c.scale[1], c.scale[2]);
+
+        // draw each edge of the polygonal approximation to the circle
+        GLfloat dx = c.getRadius(), dy = 0.0f, tx = 0.0f, ty = 0.0f;
+        if (c.showFilled)
+        {
+            glBegin(GL_TRIANGLE_FAN);
+            glVertex2f(0.0f, 0.0f);    // origin
+        }
+        else glBegin(GL_LINE_LOOP);
+        for (GLint i = 0; i <= CIRCLE_N_LINKS; ++i)
+        {
+            glVertex2f(dx, dy);    // output vertex
+
+            // calculate the tangential vector;
+            // remember, the radial vector is (x, y);
+            // to get the tangential vector, we flip those coordinates
+            // and negate one of them
+            tx  = -dy;
+            ty  =  dx;
+
+            // add the tangential vector (tan-theta)
+            dx += tx * CIRCLE_TAN_THETA;
+            dy += ty * CIRCLE_TAN_THETA;
+
+            // correct using the radial factor (cos-theta)
+            dx *= CIRCLE_COS_THETA;
+            dy *= CIRCLE_COS_THETA;
+        }
+        glEnd();
+    glPopMatrix();
+}   // drawCircleImmediate(Circle &)
@@ -0,0 +1,88 @@
+//
+// Filename:        "GLRenderer.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the OpenGL front end of the
+//                  simulation, which renders vectors as line segments with
+//                  triangle heads, circles as polygons, and robots as
+//                  circles with vector headings.  Between beginFrame() and
+//                  endFrame(), the objects drawn are batched (transformed
+//                  into one triangle array and one line array, drawn with
+//                  a draw call each at the end of the frame) instead of
+//                  being drawn one at a time in immediate mode; the arrays
+//                  are OpenGL 1.1 vertex arrays, available under software
+//                  OpenGL (e.g., Mesa) as well.  A snapshot is drawn at a
+//                  level of detail chosen by the on-screen size of each
+//                  robot (a point, a low-polygon circle, or a full circle
+//                  with its heading, which is skipped when too short to
+//                  see), and robots outside the view are culled.
+//
+
+// preprocessor directives
+#ifndef GL_RENDERER_H
+#define GL_RENDERER_H
+#include <vector>
+#include "GLTypes.h"
+#include "Renderer.h"
+using namespace std;
+
+
+
+// level-of-detail settings (on-screen sizes, in pixels)
+#define LOD_POINT_RADIUS   (1.0f)    // robots smaller are drawn as points
+#define LOD_LOW_RADIUS     (4.0f)    // robots smaller are low-polygon
+#define LOD_LOW_STRIDE     (4)       // of the circle vertices (low-polygon)
+#define LOD_HEADING_LENGTH (3.0f)    // headings shorter are skipped
+
+
+
+// forward declaration of a 2-dimensional affine transformation
+struct Affine;
+struct Snapshot;
+
+
+
+// describes an OpenGL renderer of the simulation
+class GLRenderer: public Renderer
+{
+    public:
+
+        // <constructors>
+        GLRenderer();
+
+        // <public mutator functions>
+        void beginFrame();
+        void endFrame();
+        void setView(const GLdouble left,   const GLdouble right,
+                     const GLdouble bottom, const GLdouble top,
+                     const GLint    width,  const GLint    height);
+
+        // <virtual public utility functions>
+        virtual void drawVector(Vector &v);
+        virtual void drawCircle(Circle &c);
+        virtual void drawRobot(Robot &r);
+        void         drawSnapshot(Snapshot &s);
+
+    protected:
+
+        // <protected data members>
+        bool            batching;          // between beginFrame/endFrame
+        vector<GLfloat> triangles;         // (x, y) of each vertex
+        vector<GLfloat> triangleColors;    // (r, g, b) of each vertex
+        vector<GLfloat> lines;
+        vector<GLfloat> lineColors;
+        vector<GLfloat> points;
+        vector<GLfloat> pointColors;
+        GLdouble        view[4];           // left, right, bottom, top
+        GLdouble        pixelsPerUnit;     // of the view
+
+        // <protected utility functions>
+        void batchVector(const Affine &m, const Vector &v);
+        void batchCircle(const Circle &c, const GLint stride = 1);
+        void drawHeading(const Circle &body, Vector &heading);
+        void drawVectorImmediate(Vector &v);
+        void drawCircleImmediate(Circle &c);
+};  // GLRenderer
+
+#endif
@@ -0,0 +1,29 @@
+//
+// Filename:        "GLTypes.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This file defines the OpenGL scalar types used by the
+//                  simulation core, which (unlike the front end, see
+//                  GLIncludes.h) neither includes nor links OpenGL.
+//                  The types match those of <GL/gl.h>, so the front end
+//                  may include both.
+//
+
+// preprocessor directives
+#ifndef GL_TYPES_H
+#define GL_TYPES_H
+
+
+
+// OpenGL scalar types
+typedef unsigned int  GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned char GLubyte;
+typedef int           GLint;
+typedef unsigned int  GLuint;
+typedef int           GLsizei;
+typedef float         GLfloat;
+typedef double        GLdouble;
+
+#endif
@@ -0,0 +1,353 @@
+//
+// Filename:        "Logger.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the logger of the simulation.
+//
+
+// preprocessor directives
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include "Logger.h"
+
+
+
+// the names of the levels (in LogLevel order)
+static const char *LEVEL_NAMES[N_LOG_LEVELS] =
+{
+    "trace", "debug", "info", "warn", "error", "off"
+};
+
+// the names of the categories (in LogCategory bit order)
+static const char *CATEGORY_NAMES[] =
+{
+    "env", "cell", "robot", "auction", "formation"
+};
+static const int N_CATEGORY_NAMES =
+    sizeof(CATEGORY_NAMES) / sizeof(CATEGORY_NAMES[0]);
+
+// the ring of messages (written by the simulation thread at the head,
+// read by the background thread at the tail), and the background thread
+static LogRecord                  g_ring[LOG_RING_SIZE];
+static std::atomic<unsigned long> g_head(0);
+static std::atomic<unsigned long> g_tail(0);
+static std::atomic<bool>          g_running(false);
+static std::thread                g_writer;
+static long                       g_nDropped = 0;
+
+
+
+// <static data members>
+int Logger::level      = LOG_INFO;
+int Logger::categories = LOG_ALL;
+
+
+
+// <utility functions>
+
+//
+// void writeRecord(r, f)
+// Last modified: 19Oct2026
+//
+// Formats the parameterized message (its format with its arguments,
+// whatever their length modifiers) and writes it to the parameterized file.
+//
+// Returns:     <none>
+// Parameters:
+//      r       in      the message being written
+//      f       in/out  the file written to
+//
+static void writeRecord(const LogRecord &r, FILE *f)
+{
+    const char *category = "";
+    for (int i = 0; i < N_CATEGORY_NAMES; ++i)
+        if (r.category & (1 << i))
+        {
+            category = CATEGORY_NAMES[i];
+            break;
+        }
+    fprintf(f, "[%s %s] ", LEVEL_NAMES[r.level], category);
+
+    int  arg = 0;
+    char spec[32];
+    for (const char *p = r.format; *p != '\0'; ++p)
+    {
+        if (*p != '%')
+        {
+            fputc(*p, f);
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            fputc('%', f);
+            ++p;
+            continue;
+        }
+
+        // copy the flags, width, and precision (dropping any length)
+        int n = 0;
+        spec[n++] = '%';
+        for (++p; (*p != '\0') && (strchr("-+ #0123456789.", *p) != NULL); ++p)
+            if (n < 24) spec[n++] = *p;
+        while ((*p != '\0') && (strchr("hlLqjzt", *p) != NULL)) ++p;
+        if (*p == '\0') break;
+        if (arg >= r.nArgs)
+        {
+            fputs("<?>", f);
+            continue;
+        }
+        const LogArg &a = r.args[arg++];
+        if (strchr("diouxX", *p) != NULL)
+        {
+            spec[n++] = 'l';
+            spec[n++] = *p;
+            spec[n]   = '\0';
+            fprintf(f, spec, (a.type == 'd') ? (long)a.d : a.i);
+        }
+        else if (strchr("eEfFgGaA", *p) != NULL)
+        {
+            spec[n++] = *p;
+            spec[n]   = '\0';
+            fprintf(f, spec, (a.type == 'd') ? a.d : (double)a.i);
+        }
+        else if ((*p == 's') && (a.type == 's'))
+        {
+            spec[n++] = 's';
+            spec[n]   = '\0';
+            fprintf(f, spec, (a.s == NULL) ? "(null)" : a.s);
+        }
+        else if (*p == 'c') fputc((int)a.i, f);
+        else if (a.type == 'd') fprintf(f, "%g", a.d);
+        else if (a.type == 'i') fprintf(f, "%ld", a.i);
+        else                    fputs((a.s == NULL) ? "(null)" : a.s, f);
+    }
+    fputc('\n', f);
+}   // writeRecord(const LogRecord &, FILE *)
+
+
+
+//
+// bool drain()
+// Last modified: 19Oct2026
+//
+// Writes every message in the ring (oldest first) to stdout,
+// returning true if any were written, false otherwise.
+//
+// Returns:     true if any messages were written, false otherwise
+// Parameters:  <none>
+//
+static bool drain()
+{
+    unsigned long t = g_tail.load(std::memory_order_relaxed);
+    unsigned long h = g_head.load(std::memory_order_acquire);
+    if (t == h) return false;
+    for (; t != h; ++t)
+    {
+        writeRecord(g_ring[t & (LOG_RING_SIZE - 1)], stdout);
+        g_tail.store(t + 1, std::memory_order_release);
+    }
+    fflush(stdout);
+    return true;
+}   // drain()
+
+
+
+//
+// void runWriter()
+// Last modified: 19Oct2026
+//
+// Writes the messages in the ring until the logger is stopped
+// (and the ring is empty), sleeping while the ring is empty.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+static void runWriter()
+{
+    while (true)
+    {
+        if (drain()) continue;
+        if (!g_running.load(std::memory_order_acquire))
+        {
+            drain();
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}   // runWriter()
+
+
+
+// <public static mutator functions>
+
+//
+// bool start()
+// Last modified: 19Oct2026
+//
+// Attempts to start the background writer (stopped at exit),
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Logger::start()
+{
+    static bool registered = false;
+    if (g_running.load()) return true;
+    g_running.store(true, std::memory_order_release);
+    g_writer = std::thread(runWriter);
+    if (!registered) registered = atexit(stop) == 0;
+    return true;
+}   // start()
+
+
+
+//
+// void stop()
+// Last modified: 19Oct2026
+//
+// Stops the background writer, once it has written every message
+// (after which messages are written in place).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Logger::stop()
+{
+    if (!g_running.load()) return;
+    g_running.store(false, std::memory_order_release);
+    if (g_writer.joinable()) g_writer.join();
+    if (g_nDropped > 0)
+        fprintf(stderr, ">> WARNING: %ld log messages dropped\n", g_nDropped);
+}   // stop()
+
+
+
+//
+// void setLevel(l)
+// Last modified: 19Oct2026
+//
+// Sets the lowest level of the messages written
+// (at least LOG_MIN_LEVEL, see Logger.h).
+//
+// Returns:     <none>
+// Parameters:
+//      l       in      the lowest level written
+//
+void Logger::setLevel(const LogLevel l)
+{
+    level = l;
+}   // setLevel(const LogLevel)
+
+
+
+//
+// void setCategories(mask)
+// Last modified: 19Oct2026
+//
+// Sets the categories of the messages written.
+//
+// Returns:     <none>
+// Parameters:
+//      mask    in      the categories written (a LogCategory mask)
+//
+void Logger::setCategories(const int mask)
+{
+    categories = mask;
+}   // setCategories(const int)
+
+
+
+//
+// bool parse(spec)
+// Last modified: 19Oct2026
+//
+// Attempts to set the level and categories from the parameterized
+// specification ("<level>[:<category>,...]", e.g., "debug:auction,env"),
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      spec    in      the level and categories written
+//
+bool Logger::parse(const string &spec)
+{
+    size_t colon = spec.find(':');
+    string l     = spec.substr(0, colon);
+    int    newLevel = -1, newCategories = LOG_ALL;
+    for (int i = 0; i < N_LOG_LEVELS; ++i)
+        if (l == LEVEL_NAMES[i]) newLevel = i;
+    if (newLevel < 0) return false;
+    if (colon != string::npos)
+    {
+        newCategories = 0;
+        string cats = spec.substr(colon + 1) + ",";
+        for (size_t b = 0, e; (e = cats.find(',', b)) != string::npos; b = e + 1)
+        {
+            string c = cats.substr(b, e - b);
+            int    mask = (c == "all") ? LOG_ALL : 0;
+            for (int i = 0; i < N_CATEGORY_NAMES; ++i)
+                if (c == CATEGORY_NAMES[i]) mask = 1 << i;
+            if (mask == 0) return false;
+            newCategories |= mask;
+        }
+    }
+    setLevel((LogLevel)newLevel);
+    setCategories(newCategories);
+    return true;
+}   // parse(const string &)
+
+
+
+// <public static accessor functions>
+
+//
+// long getNDropped()
+// Last modified: 19Oct2026
+//
+// Returns the number of messages dropped (because the ring was full).
+//
+// Returns:     the number of messages dropped
+// Parameters:  <none>
+//
+long Logger::getNDropped()
+{
+    return g_nDropped;
+}   // getNDropped()
+
+
+
+// <protected static utility functions>
+
+//
+// void push(r)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized message to the ring (without blocking, dropping
+// it if the ring is full), or writes it in place if the logger is stopped.
+//
+// Returns:     <none>
+// Parameters:
+//      r       in      the message being logged
+//
+void Logger::push(const LogRecord &r)
+{
+    if (!g_running.load(std::memory_order_acquire))
+    {
+        writeRecord(r, stdout);
+        return;
+    }
+    unsigned long h = g_head.load(std::memory_order_relaxed);
+    if (h - g_tail.load(std::memory_order_acquire) >= LOG_RING_SIZE)
+    {
+        ++g_nDropped;
+        return;
+    }
+    g_ring[h & (LOG_RING_SIZE - 1)] = r;
+    g_head.store(h + 1, std::memory_order_release);
+}   // push(const LogRecord &)
@@ -0,0 +1,172 @@
+//
+// Filename:        "Logger.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the logger of the simulation.  A log
+//                  message has a level and a category; messages below
+//                  LOG_MIN_LEVEL compile away entirely (the arguments are
+//                  not even evaluated), and the others are filtered by the
+//                  runtime level and categories (see parse()).
+//
+//                  An enabled message is copied (its format and arguments,
+//                  unformatted) into a lock-free ring, and a background
+//                  thread formats and writes it, so the simulation thread
+//                  never blocks on stdout (a message is dropped, and
+//                  counted, if the ring is full).  The simulation thread
+//                  is the only producer, and string arguments must outlive
+//                  the log (string literals).  Until the log is started,
+//                  messages are written in place.
+//
+//                  Compile with -DLOG_MIN_LEVEL=LOG_TRACE (or LOG_DEBUG)
+//                  to keep the debugging messages.
+//
+
+// preprocessor directives
+#ifndef LOGGER_H
+#define LOGGER_H
+#include <string>
+using namespace std;
+
+
+
+// the levels of a log message
+enum LogLevel
+{
+    LOG_TRACE = 0,
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARN,
+    LOG_ERROR,
+    LOG_OFF,
+    N_LOG_LEVELS
+};  // LogLevel
+
+// the categories of a log message (a mask)
+enum LogCategory
+{
+    LOG_ENV       = 0x01,
+    LOG_CELL      = 0x02,
+    LOG_ROBOT     = 0x04,
+    LOG_AUCTION   = 0x08,
+    LOG_FORMATION = 0x10,
+    LOG_ALL       = 0x1F
+};  // LogCategory
+
+
+
+// log definitions
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL  LOG_INFO         // compiled-in level threshold
+#endif
+#define LOG_MAX_ARGS   (6)              // arguments per message
+#define LOG_RING_SIZE  (4096)           // messages (a power of two)
+
+// is a message of the parameterized level and category written?
+#define LOG_ENABLED(level, category)                                       \
+    (((level) >= LOG_MIN_LEVEL) &&                                         \
+     (Logger::isEnabled((level), (category))))
+
+// logs a (printf-style) message of the parameterized level and category
+#define LOG(level, category, ...)                                          \
+    do                                                                     \
+    {                                                                      \
+        if (LOG_ENABLED(level, category))                                  \
+            Logger::write((level), (category), __VA_ARGS__);               \
+    } while (0)
+
+
+
+// describes an (unformatted) argument of a log message
+struct LogArg
+{
+    char type;                          // 'i'nteger, 'd'ouble, or 's'tring
+    union
+    {
+        long        i;
+        double      d;
+        const char *s;
+    };
+};  // LogArg
+
+// describes an (unformatted) log message
+struct LogRecord
+{
+    int         level;
+    int         category;
+    const char *format;
+    int         nArgs;
+    LogArg      args[LOG_MAX_ARGS];
+};  // LogRecord
+
+
+
+// describes the (process-wide) logger
+class Logger
+{
+    public:
+
+        // <public static mutator functions>
+        static bool start();
+        static void stop();
+        static void setLevel(const LogLevel l);
+        static void setCategories(const int mask);
+        static bool parse(const string &spec);
+
+        // writes a message with the parameterized format and arguments
+        template <class... Args>
+        static void write(const int   l,
+                          const int   c,
+                          const char *format,
+                          const Args&... args)
+        {
+            LogRecord r;
+            r.level    = l;
+            r.category = c;
+            r.format   = format;
+            r.nArgs    = 0;
+            addArgs(r, args...);
+            push(r);
+        }   // write(const int, const int, const char *, const Args&...)
+
+        // <public static accessor functions>
+
+        // is a message of the parameterized level and category written?
+        static bool isEnabled(const int l, const int c)
+        {
+            return (l >= level) && ((c & categories) != 0);
+        }   // isEnabled(const int, const int)
+
+        static long getNDropped();
+
+    protected:
+
+        // <protected static data members>
+        static int level;
+        static int categories;
+
+        // <protected static utility functions>
+        static void push(const LogRecord &r);
+        static void setArg(LogArg &a, const int v)           { a.type = 'i'; a.i = v; }
+        static void setArg(LogArg &a, const long v)          { a.type = 'i'; a.i = v; }
+        static void setArg(LogArg &a, const unsigned int v)  { a.type = 'i'; a.i = v; }
+        static void setArg(LogArg &a, const unsigned long v) { a.type = 'i'; a.i = (long)v; }
+        static void setArg(LogArg &a, const bool v)          { a.type = 'i'; a.i = v; }
+        static void setArg(LogArg &a, const char v)          { a.type = 'i'; a.i = v; }
+        static void setArg(LogArg &a, const float v)         { a.type = 'd'; a.d = v; }
+        static void setArg(LogArg &a, const double v)        { a.type = 'd'; a.d = v; }
+        static void setArg(LogArg &a, const char *v)         { a.type = 's'; a.s = v; }
+
+        static void addArgs(LogRecord &)
+        {
+        }   // addArgs(LogRecord &)
+
+        template <class Arg, class... Args>
+        static void addArgs(LogRecord &r, const Arg &arg, const Args&... args)
+        {
+            if (r.nArgs < LOG_MAX_ARGS) setArg(r.args[r.nArgs++], arg);
+            addArgs(r, args...);
+        }   // addArgs(LogRecord &, const Arg &, const Args&...)
+};  // Logger
+
+#endif
@@ -0,0 +1,167 @@
+//
+// Filename:        "Mailbox.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes a mailbox, a first-in, first-out
+//                  ring buffer of (at most N) values held in the mailbox
+//                  itself, so that its values are contiguous with their
+//                  owner and queueing them never allocates.  A value pushed
+//                  into a full ring spills over into a (heap-allocated)
+//                  overflow queue, which is drained after the ring; values
+//                  are never lost, and the sender counts the spills (e.g.,
+//                  a cell receiving the bids of every free robot).  A value
+//                  pushed with a key (e.g., its sender and type) is
+//                  indexed, so that a later value with the same key may
+//                  replace it in place (e.g., a newer state from the same
+//                  neighbor) without searching the mailbox; the index
+//                  holds an entry per key queued (e.g., per sender).
+//
+
+// preprocessor directives
+#ifndef MAILBOX_H
+#define MAILBOX_H
+#include <cstddef>
+#include <vector>
+
+
+
+// describes a mailbox of values of the parameterized type
+// (N must be a power of two)
+template <class T, int N>
+class Mailbox
+{
+    public:
+
+        // <constructors>
+        Mailbox(): head(0), count(0), spillHead(0), first(0) { }
+
+        // <public accessor functions>
+        bool     empty() const { return size() == 0; }
+        int      size()  const
+        {
+            return count + (int)(spill.size() - spillHead);
+        }
+        const T& front() const
+        {
+            return (count > 0) ? values[head] : spill[spillHead];
+        }
+
+        // <public mutator functions>
+
+        // returns true if the value is queued in the ring,
+        // false if it spilled over
+        bool push(const T &value)
+        {
+            if ((count == N) || (spillHead < spill.size()))
+            {
+                spill.push_back(value);
+                return false;
+            }
+            values[(head + count++) & MASK] = value;
+            return true;
+        }
+
+        // pushes the value, indexed by the parameterized key
+        bool push(const T &value, const long long key)
+        {
+            size_t k = find(key);
+            if (k == index.size())    // reuse the entry of a popped key
+            {
+                k = 0;
+                while ((k < index.size()) && (queued(index[k].seq))) ++k;
+                if (k == index.size()) index.push_back(Key());
+            }
+            index[k].key = key;
+            index[k].seq = first + size() + 1;
+            return push(value);
+        }
+
+        // returns true if the value replaces the queued value with the
+        // parameterized key, which it supersedes (supersedes(value,
+        // queued)), copied to old
+        template <class Supersedes>
+        bool replace(const T          &value,
+                     const long long   key,
+                     Supersedes        supersedes,
+                     T                &old)
+        {
+            size_t k = find(key);
+            if ((k == index.size()) || (!queued(index[k].seq))) return false;
+            T &v = at(index[k].seq);
+            if (!supersedes(value, v)) return false;
+            old = v;
+            v   = value;
+            return true;
+        }
+        void pop()
+        {
+            ++first;
+            if (count > 0)
+            {
+                head = (head + 1) & MASK;
+                --count;
+            }
+            else if (++spillHead == spill.size())
+            {
+                spill.clear();
+                spillHead = 0;
+            }
+        }
+        void clear()
+        {
+            first += size();
+            head   = count = 0;
+            spill.clear();
+            spillHead = 0;
+        }
+
+    protected:
+
+        // <protected static data members>
+        static const int MASK = N - 1;
+
+        // describes the entry of a key in the index
+        struct Key
+        {
+            long long key;
+            long long seq;    // of its latest value (from 1)
+        };  // Key
+
+        // <protected data members>
+        T                values[N];
+        int              head;         // the index of the front value
+        int              count;        // of the values in the ring
+        std::vector<T>   spill;        // values pushed while the ring was full
+        size_t           spillHead;    // the index of the front spilled value
+        long long        first;        // the number of values popped
+        std::vector<Key> index;        // of the keyed values (a key each)
+
+        // <protected utility functions>
+
+        // returns the entry of the parameterized key in the index
+        // (index.size() if it has none)
+        size_t find(const long long key) const
+        {
+            size_t k = 0;
+            while ((k < index.size()) && (index[k].key != key)) ++k;
+            return k;
+        }
+
+        // returns true if the value with the parameterized sequence
+        // number (from 1, the number of values pushed with it) is queued
+        bool queued(const long long seq) const
+        {
+            return (seq > first) && (seq <= first + size());
+        }
+
+        // returns the queued value with the parameterized sequence number
+        T& at(const long long seq)
+        {
+            int i = (int)(seq - first - 1);
+            return (i < count) ? values[(head + i) & MASK]
+                               : spill[spillHead + (i - count)];
+        }
+};  // Mailbox
+
+#endif
@@ -430,7 +430,6 @@ void Neighborhood::clearNbrs()
 //
 Neighbor* Neighborhood::anyNbr()
 {
-    srand(time(NULL));
     if (!empty()) return &at(irand(0, size()));
     return NULL;
 }   // anyNbr()
@@ -10,7 +10,8 @@
 // preprocessor directives
 #ifndef PACKET_H
 #define PACKET_H
-#include "GLIncludes.h"
+#include <cstddef>
+#include "GLTypes.h"
 using namespace std;
 
 
@@ -0,0 +1,313 @@
+//
+// Filename:        "Profiler.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the step profiler of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <fstream>
+#include <iomanip>
+#include "Profiler.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+
+
+// the names of the phases (in ProfilePhase order)
+static const char *PHASE_NAMES[N_PROFILE_PHASES] =
+{
+    "deliver", "announce", "cells", "bid", "robots", "settle", "gather",
+    "quiescence"
+};
+
+// the names of the message types (in MessageType order, see Cell.h)
+static const char *MESSAGE_TYPE_NAMES[] =
+{
+    "HEARTBEAT", "STATE", "CHANGE_FORMATION", "PUSH_AUCTION_ANNOUNCEMENT",
+    "INSERTION_AUCTION_ANNOUNCEMENT", "BID", "BUMP", "NEW_NEIGHBOR",
+    "DROP_NEIGHBOR"
+};
+static const int N_MESSAGE_TYPE_NAMES =
+    sizeof(MESSAGE_TYPE_NAMES) / sizeof(MESSAGE_TYPE_NAMES[0]);
+
+
+
+// <static data members>
+bool   Profiler::enabled                                 = false;
+double Profiler::phaseSeconds[N_PROFILE_PHASES]          = {0.0};
+long   Profiler::phaseCalls[N_PROFILE_PHASES]            = {0};
+long   Profiler::packets[PROFILE_MAX_MESSAGE_TYPES]      = {0};
+long   Profiler::stateCopies                             = 0;
+long   Profiler::formationSolves                         = 0;
+long   Profiler::steps                                   = 0;
+double Profiler::stepSeconds                             = 0.0;
+
+
+
+// <public static mutator functions>
+
+//
+// void enable(e)
+// Last modified: 19Oct2026
+//
+// Enables (or disables) profiling.
+//
+// Returns:     <none>
+// Parameters:
+//      e       in      true to enable profiling, false to disable it
+//
+void Profiler::enable(const bool e)
+{
+    enabled = e;
+}   // enable(const bool)
+
+
+
+//
+// void reset()
+// Last modified: 19Oct2026
+//
+// Clears every timer and counter.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Profiler::reset()
+{
+    for (int i = 0; i < N_PROFILE_PHASES; ++i)
+    {
+        phaseSeconds[i] = 0.0;
+        phaseCalls[i]   = 0;
+    }
+    for (int i = 0; i < PROFILE_MAX_MESSAGE_TYPES; ++i) packets[i] = 0;
+    stateCopies = formationSolves = steps = 0;
+    stepSeconds = 0.0;
+}   // reset()
+
+
+
+//
+// void addTime(phase, seconds)
+// Last modified: 19Oct2026
+//
+// Adds the parameterized time to the parameterized phase.
+//
+// Returns:     <none>
+// Parameters:
+//      phase   in      the phase that was timed
+//      seconds in      the time spent in the phase
+//
+void Profiler::addTime(const ProfilePhase phase, const double seconds)
+{
+    phaseSeconds[phase] += seconds;
+    ++phaseCalls[phase];
+}   // addTime(const ProfilePhase, const double)
+
+
+
+//
+// void addStep(seconds)
+// Last modified: 19Oct2026
+//
+// Adds a step that took the parameterized time.
+//
+// Returns:     <none>
+// Parameters:
+//      seconds in      the time spent in the step
+//
+void Profiler::addStep(const double seconds)
+{
+    stepSeconds += seconds;
+    ++steps;
+}   // addStep(const double)
+
+
+
+// <public static accessor functions>
+
+//
+// double now()
+// Last modified: 19Oct2026
+//
+// Returns the time (in seconds) of the monotonic clock.
+//
+// Returns:     the time of the monotonic clock
+// Parameters:  <none>
+//
+double Profiler::now()
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}   // now()
+
+
+
+//
+// long getPeakRSS()
+// Last modified: 19Oct2026
+//
+// Returns the peak resident set size (in kilobytes) of the process.
+//
+// Returns:     the peak resident set size (in kilobytes)
+// Parameters:  <none>
+//
+long Profiler::getPeakRSS()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return (long)(pmc.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;          // (in bytes on Mac OS X)
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}   // getPeakRSS()
+
+
+
+//
+// bool write(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to write the profile to the parameterized file (as JSON if its
+// name ends in ".json", as CSV otherwise), returning true if successful,
+// false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the profile file
+//
+bool Profiler::write(const string &filename)
+{
+    size_t n = filename.size();
+    if ((n >= 5) && (filename.compare(n - 5, 5, ".json") == 0))
+        return writeJSON(filename);
+    return writeCSV(filename);
+}   // write(const string &)
+
+
+
+//
+// const char* getPhaseName(phase)
+// Last modified: 19Oct2026
+//
+// Returns the name of the parameterized phase ("step" for a whole step).
+//
+// Returns:     the name of the phase
+// Parameters:
+//      phase   in      the phase (or N_PROFILE_PHASES for a whole step)
+//
+const char* Profiler::getPhaseName(const int phase)
+{
+    return ((phase >= 0) && (phase < N_PROFILE_PHASES)) ? PHASE_NAMES[phase]
+                                                         : "step";
+}   // getPhaseName(const int)
+
+
+
+// <protected static utility functions>
+
+//
+// bool writeCSV(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to write the profile to the parameterized file as CSV
+// (section, name, value, calls), returning true if successful,
+// false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the profile file
+//
+bool Profiler::writeCSV(const string &filename)
+{
+    ofstream os(filename.c_str());
+    if (!os) return false;
+    os << setprecision(9);
+    os << "section,name,value,calls" << endl;
+    os << "step,total," << stepSeconds << "," << steps << endl;
+    for (int i = 0; i < N_PROFILE_PHASES; ++i)
+        os << "phase," << PHASE_NAMES[i] << "," << phaseSeconds[i] << ","
+           << phaseCalls[i] << endl;
+    for (int i = 0; i < PROFILE_MAX_MESSAGE_TYPES; ++i)
+    {
+        if ((i >= N_MESSAGE_TYPE_NAMES) && (packets[i] == 0)) continue;
+        os << "packets,";
+        if (i < N_MESSAGE_TYPE_NAMES) os << MESSAGE_TYPE_NAMES[i];
+        else                          os << "TYPE_" << i;
+        os << "," << packets[i] << "," << endl;
+    }
+    os << "count,state_copies,"     << stateCopies     << "," << endl;
+    os << "count,formation_solves," << formationSolves << "," << endl;
+    os << "memory,peak_rss_kb,"     << getPeakRSS()    << "," << endl;
+    return os.good();
+}   // writeCSV(const string &)
+
+
+
+//
+// bool writeJSON(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to write the profile to the parameterized file as JSON,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the profile file
+//
+bool Profiler::writeJSON(const string &filename)
+{
+    ofstream os(filename.c_str());
+    if (!os) return false;
+    os << setprecision(9);
+    os << "{" << endl
+       << "  \"steps\": " << steps << "," << endl
+       << "  \"step_seconds\": " << stepSeconds << "," << endl
+       << "  \"phases\": {" << endl;
+    for (int i = 0; i < N_PROFILE_PHASES; ++i)
+        os << "    \"" << PHASE_NAMES[i] << "\": {\"seconds\": "
+           << phaseSeconds[i] << ", \"calls\": " << phaseCalls[i] << "}"
+           << ((i + 1 < N_PROFILE_PHASES) ? "," : "") << endl;
+    os << "  }," << endl
+       << "  \"packets\": {" << endl;
+    bool first = true;
+    for (int i = 0; i < PROFILE_MAX_MESSAGE_TYPES; ++i)
+    {
+        if ((i >= N_MESSAGE_TYPE_NAMES) && (packets[i] == 0)) continue;
+        os << (first ? "" : ",\n") << "    \"";
+        if (i < N_MESSAGE_TYPE_NAMES) os << MESSAGE_TYPE_NAMES[i];
+        else                          os << "TYPE_" << i;
+        os << "\": " << packets[i];
+        first = false;
+    }
+    os << endl << "  }," << endl
+       << "  \"state_copies\": " << stateCopies << "," << endl
+       << "  \"formation_solves\": " << formationSolves << "," << endl
+       << "  \"peak_rss_kb\": " << getPeakRSS() << endl
+       << "}" << endl;
+    return os.good();
+}   // writeJSON(const string &)
@@ -0,0 +1,144 @@
+//
+// Filename:        "Profiler.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the step profiler of the
+//                  simulation, which times each phase of a step with a
+//                  monotonic clock and counts the packets sent (by message
+//                  type), the cell state copies, and the formation solves.
+//                  Every hook checks one flag when profiling is disabled,
+//                  so the profiler stays compiled in.
+//
+
+// preprocessor directives
+#ifndef PROFILER_H
+#define PROFILER_H
+#include <string>
+#include <vector>
+#include "FlightRecorder.h"
+#include "Trace.h"
+using namespace std;
+
+
+
+// profiler definitions
+#define PROFILE_MAX_MESSAGE_TYPES (16)   // packet counters (by message type)
+
+
+
+// the phases of a step
+enum ProfilePhase
+{
+    PHASE_DELIVER = 0,      // discrete message passing (states, delivery)
+    PHASE_ANNOUNCE,         // insertion auction announcements
+    PHASE_CELLS,            // cell steps (push auctions are announced here)
+    PHASE_BID,              // batched bid evaluation
+    PHASE_ROBOTS,           // robot packet processing and steps
+    PHASE_SETTLE,           // auction settlement
+    PHASE_GATHER,           // gathered metrics (messages, distances, error)
+    PHASE_QUIESCENCE,       // quiescence test
+    N_PROFILE_PHASES
+};  // ProfilePhase
+
+
+
+// describes the (process-wide) step profiler
+class Profiler
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static void enable(const bool e = true);
+        static void reset();
+        static void addTime(const ProfilePhase phase, const double seconds);
+        static void addStep(const double seconds);
+
+        // counts a packet of the parameterized message type
+        static void countPacket(const int type)
+        {
+            if ((enabled) && (type >= 0) && (type < PROFILE_MAX_MESSAGE_TYPES))
+                ++packets[type];
+            FlightRecorder::countPacket();
+        }   // countPacket(const int)
+
+        // counts a copy of a cell state
+        static void countStateCopy()
+        {
+            if (enabled) ++stateCopies;
+            FlightRecorder::countStateCopy();
+        }   // countStateCopy()
+
+        // counts a formation solve (one neighbor relationship)
+        static void countFormationSolve()
+        {
+            if (enabled) ++formationSolves;
+            FlightRecorder::countFormationSolve();
+        }   // countFormationSolve()
+
+        // <public static accessor functions>
+        static double      now();
+        static long        getPeakRSS();
+        static bool        write(const string &filename);
+        static const char* getPhaseName(const int phase);
+
+    protected:
+
+        // <protected static data members>
+        static double phaseSeconds[N_PROFILE_PHASES];
+        static long   phaseCalls[N_PROFILE_PHASES];
+        static long   packets[PROFILE_MAX_MESSAGE_TYPES];
+        static long   stateCopies;
+        static long   formationSolves;
+        static long   steps;
+        static double stepSeconds;
+
+        // <protected static utility functions>
+        static bool writeCSV(const string &filename);
+        static bool writeJSON(const string &filename);
+};  // Profiler
+
+
+
+// times a phase (or a step, if no phase) for the lifetime of the timer
+// (and records it and traces it as a span), reading the clock only when
+// profiling, recording, or tracing is enabled
+class ProfileTimer
+{
+    public:
+
+        // <constructors>
+        ProfileTimer(const int p = N_PROFILE_PHASES)
+            : phase(p),
+              start(((Profiler::enabled) || (FlightRecorder::enabled) ||
+                     (Trace::enabled)) ? Profiler::now() : 0.0)
+        {
+        }   // ProfileTimer(const int)
+
+        // <destructors>
+        ~ProfileTimer()
+        {
+            if ((!Profiler::enabled) && (!FlightRecorder::enabled) &&
+                (!Trace::enabled)) return;
+            double end = Profiler::now();
+            if ((Profiler::enabled) && (phase < N_PROFILE_PHASES))
+                Profiler::addTime((ProfilePhase)phase, end - start);
+            else if (Profiler::enabled) Profiler::addStep(end - start);
+            if ((FlightRecorder::enabled) && (phase < N_PROFILE_PHASES))
+                FlightRecorder::addTime(phase, end - start);
+            else if (FlightRecorder::enabled)
+                FlightRecorder::addStep(end - start);
+            Trace::span(Profiler::getPhaseName(phase), start, end);
+        }   // ~ProfileTimer()
+
+    protected:
+
+        // <protected data members>
+        int    phase;
+        double start;
+};  // ProfileTimer
+
+#endif
@@ -12,7 +12,7 @@
 #ifndef RELATIONSHIP_H
 #define RELATIONSHIP_H
 #include <vector>
-#include "GLIncludes.h"
+#include "GLTypes.h"
 #include "Packet.h"
 #include "Vector.h"
 using namespace std;
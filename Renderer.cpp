@@ -0,0 +1,35 @@
+//
+// Filename:        "Renderer.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the front end that renders the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <cstddef>
+#include "Renderer.h"
+
+
+
+// <public static data members>
+Renderer *Renderer::current = NULL;
+
+
+
+// <destructors>
+
+//
+// ~Renderer()
+// Last modified: 19Oct2026
+//
+// Destructor that clears this renderer.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+Renderer::~Renderer()
+{
+    if (current == this) current = NULL;
+}   // ~Renderer()
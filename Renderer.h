@@ -0,0 +1,43 @@
+//
+// Filename:        "Renderer.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the front end that renders the
+//                  simulation.  The simulation core does no rendering of
+//                  its own: the draw() of each vector, circle, and robot
+//                  is passed to the current renderer (see GLRenderer.h),
+//                  and does nothing when there is none (i.e., headless).
+//
+
+// preprocessor directives
+#ifndef RENDERER_H
+#define RENDERER_H
+
+
+
+// forward declarations of the rendered objects
+class Vector;
+class Circle;
+class Robot;
+
+
+
+// describes a renderer of the simulation
+class Renderer
+{
+    public:
+
+        // <public static data members>
+        static Renderer *current;    // NULL = headless (no rendering)
+
+        // <destructors>
+        virtual ~Renderer();
+
+        // <virtual public utility functions>
+        virtual void drawVector(Vector &v) = 0;
+        virtual void drawCircle(Circle &c) = 0;
+        virtual void drawRobot(Robot &r)   = 0;
+};  // Renderer
+
+#endif
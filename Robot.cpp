@@ -9,6 +9,7 @@
 
 // preprocessor directives
 #include "Environment.h"
+#include "Renderer.h"
 #include "Robot.h"
 
 #define FLT_MAX 1E+37
@@ -358,35 +359,15 @@ GLfloat Robot::getArcRadius() const
 // void draw()
 // Last modified: 27Aug2006
 //
-// Renders the robot as a circle with a vector heading.
+// Renders the robot as a circle with a vector heading
+// (by the current renderer, if any, see Renderer.h).
 //
 // Returns:     <none>
 // Parameters:  <none>
 //
 void Robot::draw()
 {
-    if ((color[GLUT_RED]   == COLOR[INVISIBLE][GLUT_RED])   &&
-        (color[GLUT_GREEN] == COLOR[INVISIBLE][GLUT_GREEN]) &&
-        (color[GLUT_BLUE]  == COLOR[INVISIBLE][GLUT_BLUE])) return;
-
-    // draw a circle representing the robot
-    Circle::draw();
-
-    // draw a vector representing the robot heading
-    if (showHeading)
-    {
-        glPushMatrix();
-            glRotated(rotate[0], 0, 0, 1);
-            glRotated(rotate[1], 0, 0, 1);
-            glRotated(rotate[2], 0, 0, 1);
-            heading.translated(x + translate[0],
-                               y + translate[1],
-                               z + translate[2]);
-            heading.scaled(radius / DEFAULT_ROBOT_RADIUS);
-            heading.setColor(color);
-            heading.draw();
-        glPopMatrix();
-    }
+    if (Renderer::current != NULL) Renderer::current->drawRobot(*this);
 }   // draw()
 
 
@@ -416,7 +397,9 @@ Robot* Robot::auctioningStep()
 
         if(AUTONOMOUS_INIT)
         {
-            if(auctionStepCount==0)
+            // hold off while backing off from unanswered auctions
+            if((auctionStepCount==0)&&
+               ((env == NULL)||(env->stepCount >= nextAuctionStep)))
             {
                 answer = this;
                 //cout << "Robot["<<ID<<"] is going to hold an auction."<<endl;
@@ -1133,6 +1116,9 @@ bool Robot::init(const GLfloat dx,    const GLfloat dy, const GLfloat dz,
     heading.showLine = DEFAULT_ROBOT_SHOW_LINE;
     heading.showHead = DEFAULT_ROBOT_SHOW_HEAD;
     showFilled       = DEFAULT_ROBOT_SHOW_FILLED;
+    auctionStepCount = 0;
+    auctionBackoff   = AUCTION_BACKOFF;
+    nextAuctionStep  = 0;
     setEnvironment(NULL);
     return true;
 }   // init(const GLfloat..<4>, const Color)
@@ -1207,6 +1193,38 @@ bool Robot::processPacket(Packet &p)
 
 
 
+//
+// bool bidOnPushAuctions(kernel, b)
+// Last modified: 19Oct2026
+//
+// Bids on every push auction of the step in range of this robot, using
+// the ranges of the batched bid kernel of the step in place of the range
+// sensor (see Environment::bidOnPushAuctions()), returning true if
+// successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      kernel  in      the bid kernel of the step
+//      b       in      the index of this robot as a bidder in the kernel
+//
+bool Robot::bidOnPushAuctions(const BidKernel &kernel, const GLint b)
+{
+    bool success = true;
+    for (GLint a = 0; a < kernel.getNAuctions(); ++a)
+    {
+        GLfloat range = kernel.getRange(b, a);
+        if (range <= 0.0f) continue;
+        GLfloat b_j = E * range;
+        Bid    *bid = new Bid(b_j, getID());
+        Trace::instant("bid", "auction", "robot", ID, "cell", kernel.getAuctionID(a));
+        if (!env->sendMsg(bid, kernel.getAuctionID(a), (-1 * (ID * 10)), BID))
+            success = false;
+    }
+    return success;
+}   // bidOnPushAuctions(const BidKernel &, const GLint)
+
+
+
 //
 // GLfloat rangeSensor(p)
 // Last modified: 08Nov2009
@@ -1360,25 +1378,9 @@ bool Robot::settleAuction()
     //cout << "in robot::settleAuction for robot["<<ID<<"]" << endl;
     //auctionStepCount = 0;
     bool success=false;
-    if((auctionStepCount>0)&&(bids.size()>0))
+    Bid* winningBid = getWinningBid<LowestBid>();
+    if(winningBid != NULL)
     {
-        //cout << "inside Robot::settleAuction()"<<endl;
-    	Bid* winningBid;
-        winningBid = bids[0];
-        if(!INSERTION_RANDOM)
-        {
-            for(int i=0;i<bids.size();i++)
-            {
-                if(bids[i]->b_i < winningBid->b_i)
-                {
-                    winningBid = bids[i];
-                }
-            }
-        } else {
-            srand(time(NULL));
-            int windex = rand() % bids.size();
-            winningBid = bids[windex];
-        }
         //cout <<"Cell # "<<winningBid->bID<<" won the auction" << endl;
         env->settleInsertionAuction(this,winningBid->bID);
         //bids.clear();
@@ -1387,9 +1389,39 @@ bool Robot::settleAuction()
         //printf("No bids received, auction closes.\n");
 
     }
-    bids.clear();
-    auctionStepCount = 0;
+    closeAuction();
     return success;
 
 }
-
+
+
+
+//
+// void closeAuction()
+// Last modified: 19Oct2026
+//
+// Closes the open auction of this robot (discarding its bids).  A robot
+// that was outbid announces again on its next step, but one that received
+// no bids waits before announcing again, doubling the wait (up to
+// AUCTION_BACKOFF_MAX steps) for each unanswered auction in a row.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void Robot::closeAuction()
+{
+    if((auctionStepCount > 0) && (env != NULL))
+    {
+        if(bids.size() > 0)
+        {
+            auctionBackoff  = AUCTION_BACKOFF;
+            nextAuctionStep = env->stepCount + 1;
+        } else {
+            nextAuctionStep = env->stepCount + auctionBackoff;
+            auctionBackoff  = min(2 * auctionBackoff, AUCTION_BACKOFF_MAX);
+        }
+    }
+    bids.clear();
+    auctionStepCount = 0;
+}   // closeAuction()
+
@@ -12,7 +12,9 @@
 #define ROBOT_H
 #include <queue>
 #include "Behavior.h"
+#include "BidKernel.h"
 #include "Circle.h"
+#include "Mailbox.h"
 #include "Packet.h"
 using namespace std;
 
@@ -20,6 +22,7 @@ using namespace std;
 
 //
 #define SENSOR_RANGE (999999.0f)
+#define MAILBOX_CAPACITY (16)    // packets held per robot (a power of two)
 
 
 
@@ -52,7 +55,8 @@ class Robot: public Circle
         Vector   heading;          // 3D vector heading of robot
         Behavior behavior;         // behavior of robot
         bool     showHeading;      // shows the vector heading of the robot
-        queue<Packet> msgQueue;    // message packet queue for communication
+        Mailbox<Packet, MAILBOX_CAPACITY>
+                 msgQueue;         // message packet queue for communication
 
         // <constructors>
         Robot(const GLfloat dx         = 0.0f,
@@ -146,7 +150,19 @@ class Robot: public Circle
         GLint   getNBids() const;
         int     getAuctionStepCount() const;
         float   getDistanceTraveled() const;
+        bool    bidOnPushAuctions(const BidKernel &kernel, const GLint b);
         bool    settleAuction();
+        void    closeAuction();
+
+        // the winning bid of the open insertion auction of this robot
+        // (by the parameterized bid rule, see Auctioning.h), or NULL
+        // if there is no open auction or no bids were received
+        template <class Select>
+        Bid* getWinningBid() const
+        {
+            return (auctionStepCount <= 0) ? NULL : Select::select(bids);
+        }   // getWinningBid() const
+
         bool    setAuctionStepCount(const int& asc);
         void updateDistanceTraveled();
         bool isNumber(const GLfloat& n);
@@ -165,6 +181,8 @@ class Robot: public Circle
         GLint         numBids;
         GLfloat       prevX, prevY;
         int           auctionStepCount;
+        int           auctionBackoff;     // wait after an unanswered auction
+        int           nextAuctionStep;    // first step it may announce again
         GLfloat       distanceTraveled;
 
         // <protected static data members>
@@ -0,0 +1,530 @@
+//
+// Filename:        "SeedFile.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements a file of initial robot positions.
+//
+
+// preprocessor directives
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "SeedFile.h"
+
+#ifdef _WIN32
+#define SEED_FILE_NO_MMAP
+#endif
+
+#ifndef SEED_FILE_NO_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+// exact powers of ten used by the fast text parser
+static const double POW10[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+static const int POW10_MAX = 22;
+
+
+
+//
+// bool isSeparator(c)
+// Last modified: 19Oct2026
+//
+// Returns true if the parameterized character separates
+// values in a text seed file, false otherwise.
+//
+// Returns:     true if the character is a separator, false otherwise
+// Parameters:
+//      c       in      the character being tested
+//
+static inline bool isSeparator(const char c)
+{
+    return (c == ' ')  || (c == ',')  || (c == '\n') ||
+           (c == '\r') || (c == '\t') || (c == ';');
+}   // isSeparator(const char)
+
+
+
+//
+// const char* parseFloat(p, end, f)
+// Last modified: 19Oct2026
+//
+// Parses a decimal floating-point number beginning at the parameterized
+// position, returning the position following the number, or NULL if
+// no number could be parsed.  Values with at most 19 significant digits
+// and a small exponent are computed with a single exact scaling; others
+// fall back to strtod().
+//
+// Returns:     the position following the number (NULL on failure)
+// Parameters:
+//      p       in      the position to begin parsing at
+//      end     in      the end of the buffer
+//      f       out     the parsed number
+//
+static const char* parseFloat(const char *p, const char *end, float &f)
+{
+    const char *start    = p;
+    bool        negative = false;
+    if ((p < end) && ((*p == '-') || (*p == '+'))) negative = (*p++ == '-');
+
+    unsigned long long mantissa = 0ULL;
+    int                nDigits  = 0, scale = 0;
+    bool               any      = false;
+    while ((p < end) && (*p >= '0') && (*p <= '9'))
+    {
+        if (nDigits < 19) mantissa = 10ULL * mantissa + (*p - '0'), ++nDigits;
+        else              ++scale;
+        if (mantissa == 0ULL) nDigits = 0;    // leading zeros are free
+        any = true;
+        ++p;
+    }
+    if ((p < end) && (*p == '.'))
+    {
+        ++p;
+        while ((p < end) && (*p >= '0') && (*p <= '9'))
+        {
+            if (nDigits < 19)
+            {
+                mantissa = 10ULL * mantissa + (*p - '0');
+                if (mantissa != 0ULL) ++nDigits;
+                --scale;
+            }
+            any = true;
+            ++p;
+        }
+    }
+    if (!any) return NULL;
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        const char *q      = p + 1;
+        bool        expNeg = false;
+        if ((q < end) && ((*q == '-') || (*q == '+'))) expNeg = (*q++ == '-');
+        if ((q < end) && (*q >= '0') && (*q <= '9'))
+        {
+            int e = 0;
+            while ((q < end) && (*q >= '0') && (*q <= '9'))
+            {
+                if (e < 10000) e = 10 * e + (*q - '0');
+                ++q;
+            }
+            scale += expNeg ? -e : e;
+            p      = q;
+        }
+    }
+
+    double value;
+    if ((mantissa < (1ULL << 53)) && (scale >= -POW10_MAX) &&
+        (scale <= POW10_MAX))
+    {
+        value = (double)mantissa;
+        value = (scale < 0) ? value / POW10[-scale] : value * POW10[scale];
+    }
+    else
+    {
+
+        // slow path: copy the token so strtod() cannot read past the buffer
+        char   token[64];
+        size_t len = min((size_t)(p - start), sizeof(token) - 1);
+        memcpy(token, start, len);
+        token[len] = '\0';
+        f = (float)strtod(token, NULL);
+        return p;
+    }
+    f = (float)(negative ? -value : value);
+    return p;
+}   // parseFloat(const char *, const char *, float &)
+
+
+
+// <constructors>
+
+//
+// SeedFile()
+// Last modified: 19Oct2026
+//
+// Default constructor that initializes this seed file to be empty.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+SeedFile::SeedFile()
+    : format(SEED_FORMAT_NONE), positions(NULL), nPositions(0),
+      mapping(NULL), mappingSize(0)
+{
+}   // SeedFile()
+
+
+
+//
+// SeedFile(filename)
+// Last modified: 19Oct2026
+//
+// Constructor that opens the seed file with the parameterized name.
+//
+// Returns:     <none>
+// Parameters:
+//      filename    in      the name of the seed file
+//
+SeedFile::SeedFile(const string &filename)
+    : format(SEED_FORMAT_NONE), positions(NULL), nPositions(0),
+      mapping(NULL), mappingSize(0)
+{
+    open(filename);
+}   // SeedFile(const string &)
+
+
+
+// <destructors>
+
+//
+// ~SeedFile()
+// Last modified: 19Oct2026
+//
+// Destructor that closes this seed file.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+SeedFile::~SeedFile()
+{
+    close();
+}   // ~SeedFile()
+
+
+
+// <public mutator functions>
+
+//
+// bool open(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to open (memory-map) the seed file with the parameterized name,
+// detecting its format and returning true if successful, false otherwise.
+// Binary positions are used in place; text positions are parsed once.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the seed file
+//
+bool SeedFile::open(const string &filename)
+{
+    close();
+    if (!map(filename)) return false;
+
+    const char *data = (const char *)mapping;
+    if ((mappingSize >= sizeof(SeedFileHeader)) &&
+        (!memcmp(data, SEED_FILE_MAGIC, SEED_FILE_MAGIC_SIZE)))
+    {
+        const SeedFileHeader *h = (const SeedFileHeader *)data;
+        size_t needed = sizeof(SeedFileHeader) +
+                        2 * sizeof(float) * (size_t)h->nPositions;
+        if ((h->byteOrder != SEED_FILE_BYTE_ORDER) || (mappingSize < needed))
+        {
+            cerr << ">> ERROR: Seed file '" << filename
+                 << "' is truncated or has a foreign byte order.\n\n";
+            close();
+            return false;
+        }
+        format     = SEED_FORMAT_BINARY;
+        positions  = (const float *)(data + sizeof(SeedFileHeader));
+        nPositions = h->nPositions;
+        return true;
+    }
+
+    bool result = parseText(data, data + mappingSize);
+    unmap();
+    return result;
+}   // open(const string &)
+
+
+
+//
+// void close()
+// Last modified: 19Oct2026
+//
+// Closes this seed file, releasing its contents.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void SeedFile::close()
+{
+    unmap();
+    parsed.clear();
+    format     = SEED_FORMAT_NONE;
+    positions  = NULL;
+    nPositions = 0;
+}   // close()
+
+
+
+// <public accessor functions>
+
+//
+// SeedFormat getFormat() const
+// Last modified: 19Oct2026
+//
+// Returns the format of the opened seed file.
+//
+// Returns:     the format of the opened seed file
+// Parameters:  <none>
+//
+SeedFormat SeedFile::getFormat() const
+{
+    return format;
+}   // getFormat() const
+
+
+
+//
+// unsigned int getNPositions() const
+// Last modified: 19Oct2026
+//
+// Returns the number of (x, y) positions in the seed file.
+//
+// Returns:     the number of (x, y) positions in the seed file
+// Parameters:  <none>
+//
+unsigned int SeedFile::getNPositions() const
+{
+    return nPositions;
+}   // getNPositions() const
+
+
+
+//
+// float getX(i) const
+// Last modified: 19Oct2026
+//
+// Returns the x-coordinate of the parameterized position.
+//
+// Returns:     the x-coordinate of the parameterized position
+// Parameters:
+//      i       in      the index of the position
+//
+float SeedFile::getX(const unsigned int i) const
+{
+    return positions[2 * i];
+}   // getX(const unsigned int) const
+
+
+
+//
+// float getY(i) const
+// Last modified: 19Oct2026
+//
+// Returns the y-coordinate of the parameterized position.
+//
+// Returns:     the y-coordinate of the parameterized position
+// Parameters:
+//      i       in      the index of the position
+//
+float SeedFile::getY(const unsigned int i) const
+{
+    return positions[2 * i + 1];
+}   // getY(const unsigned int) const
+
+
+
+//
+// const float* getPositions() const
+// Last modified: 19Oct2026
+//
+// Returns the interleaved (x, y) positions of the seed file.
+//
+// Returns:     the interleaved (x, y) positions of the seed file
+// Parameters:  <none>
+//
+const float* SeedFile::getPositions() const
+{
+    return positions;
+}   // getPositions() const
+
+
+
+// <public static utility functions>
+
+//
+// bool writeBinary(filename, xy)
+// Last modified: 19Oct2026
+//
+// Attempts to write the parameterized interleaved positions
+// to a binary seed file, returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the seed file
+//      xy          in      the interleaved (x, y) positions
+//
+bool SeedFile::writeBinary(const string &filename, const vector<float> &xy)
+{
+    FILE *fp = fopen(filename.c_str(), "wb");
+    if (fp == NULL) return false;
+
+    SeedFileHeader h;
+    memcpy(h.magic, SEED_FILE_MAGIC, SEED_FILE_MAGIC_SIZE);
+    h.byteOrder  = SEED_FILE_BYTE_ORDER;
+    h.nPositions = (unsigned int)(xy.size() / 2);
+    bool ok = fwrite(&h, sizeof(h), 1, fp) == 1;
+    if ((ok) && (h.nPositions > 0))
+        ok = fwrite(&xy[0], 2 * sizeof(float), h.nPositions, fp) ==
+             h.nPositions;
+    return (fclose(fp) == 0) && ok;
+}   // writeBinary(const string &, const vector<float> &)
+
+
+
+//
+// bool writeText(filename, xy)
+// Last modified: 19Oct2026
+//
+// Attempts to write the parameterized interleaved positions to a text
+// seed file (one value per line, as read by earlier simulator versions),
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the seed file
+//      xy          in      the interleaved (x, y) positions
+//
+bool SeedFile::writeText(const string &filename, const vector<float> &xy)
+{
+    FILE *fp = fopen(filename.c_str(), "w");
+    if (fp == NULL) return false;
+    bool ok = true;
+    for (size_t i = 0; (ok) && (i < xy.size()); ++i)
+        ok = fprintf(fp, "%g\n", xy[i]) > 0;
+    return (fclose(fp) == 0) && ok;
+}   // writeText(const string &, const vector<float> &)
+
+
+
+// <protected utility functions>
+
+//
+// bool map(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to map the contents of the file with the parameterized name
+// into memory, returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the file
+//
+bool SeedFile::map(const string &filename)
+{
+#ifndef SEED_FILE_NO_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if ((fstat(fd, &st) != 0) || (st.st_size <= 0))
+    {
+        ::close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) return false;
+    madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+    mapping     = p;
+    mappingSize = (size_t)st.st_size;
+#else
+    ifstream in(filename.c_str(), ios::in | ios::binary);
+    if (!in) return false;
+    in.seekg(0, ios::end);
+    streamoff size = in.tellg();
+    if (size <= 0) return false;
+    in.seekg(0, ios::beg);
+    mapping = malloc((size_t)size);
+    if (mapping == NULL) return false;
+    in.read((char *)mapping, size);
+    mappingSize = (size_t)size;
+#endif
+    return true;
+}   // map(const string &)
+
+
+
+//
+// void unmap()
+// Last modified: 19Oct2026
+//
+// Releases the mapped contents of the file.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void SeedFile::unmap()
+{
+    if (mapping == NULL) return;
+#ifndef SEED_FILE_NO_MMAP
+    munmap(mapping, mappingSize);
+#else
+    free(mapping);
+#endif
+    mapping     = NULL;
+    mappingSize = 0;
+}   // unmap()
+
+
+
+//
+// bool parseText(begin, end)
+// Last modified: 19Oct2026
+//
+// Parses the values of a text seed file, accepting both the
+// one-value-per-line format and the "x,y" per line format,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      begin   in      the beginning of the text
+//      end     in      the end of the text
+//
+bool SeedFile::parseText(const char *begin, const char *end)
+{
+    parsed.clear();
+
+    // estimate the number of values from the number of lines
+    size_t nLines = 1;
+    for (const char *p = begin; p < end; ++p) if (*p == '\n') ++nLines;
+    parsed.reserve(2 * nLines + 2);
+
+    const char *p = begin;
+    while (p < end)
+    {
+        while ((p < end) && (isSeparator(*p))) ++p;
+        if (p >= end) break;
+        float       f;
+        const char *next = parseFloat(p, end, f);
+        if (next == NULL)
+        {
+
+            // skip an unparseable token (e.g., a header line)
+            while ((p < end) && (!isSeparator(*p))) ++p;
+            continue;
+        }
+        parsed.push_back(f);
+        p = next;
+    }
+    if (parsed.size() % 2) parsed.pop_back();
+
+    format     = SEED_FORMAT_TEXT;
+    positions  = parsed.empty() ? NULL : &parsed[0];
+    nPositions = (unsigned int)(parsed.size() / 2);
+    return true;
+}   // parseText(const char *, const char *)
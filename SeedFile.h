@@ -0,0 +1,93 @@
+//
+// Filename:        "SeedFile.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes a file of initial robot positions
+//                  (seeds), loaded from either the binary seed format or
+//                  the text formats (one value per line, or "x,y" lines).
+//
+
+// preprocessor directives
+#ifndef SEED_FILE_H
+#define SEED_FILE_H
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+// binary seed format definitions
+#define SEED_FILE_MAGIC      "CSEED01\n"    // 8-byte file signature
+#define SEED_FILE_MAGIC_SIZE (8)
+#define SEED_FILE_BYTE_ORDER (0x01020304)   // detects foreign byte order
+
+
+
+// seed file format index values
+enum SeedFormat
+{
+    SEED_FORMAT_NONE = 0,
+    SEED_FORMAT_BINARY,
+    SEED_FORMAT_TEXT
+};  // SeedFormat
+
+
+
+// defines the header of a binary seed file, which
+// is followed by (nPositions * 2) interleaved x, y floats
+struct SeedFileHeader
+{
+    char         magic[SEED_FILE_MAGIC_SIZE];
+    unsigned int byteOrder;
+    unsigned int nPositions;
+};  // SeedFileHeader
+
+
+
+// describes a file of initial robot positions
+class SeedFile
+{
+    public:
+
+        // <constructors>
+        SeedFile();
+        SeedFile(const string &filename);
+
+        // <destructors>
+        virtual ~SeedFile();
+
+        // <public mutator functions>
+        bool open(const string &filename);
+        void close();
+
+        // <public accessor functions>
+        SeedFormat   getFormat()     const;
+        unsigned int getNPositions() const;
+        float        getX(const unsigned int i) const;
+        float        getY(const unsigned int i) const;
+        const float* getPositions()  const;
+
+        // <public static utility functions>
+        static bool writeBinary(const string        &filename,
+                                const vector<float> &xy);
+        static bool writeText(const string        &filename,
+                              const vector<float> &xy);
+
+    protected:
+
+        // <protected data members>
+        SeedFormat    format;       // the format of the opened file
+        const float  *positions;    // interleaved x, y positions
+        unsigned int  nPositions;   // the number of (x, y) positions
+        vector<float> parsed;       // storage for positions parsed from text
+        void         *mapping;      // the memory-mapped file contents
+        size_t        mappingSize;  // the size of the mapping (in bytes)
+
+        // <protected utility functions>
+        bool map(const string &filename);
+        void unmap();
+        bool parseText(const char *begin, const char *end);
+};  // SeedFile
+
+#endif
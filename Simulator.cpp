@@ -10,7 +10,21 @@
 // preprocessor directives
 #include <signal.h>
 #include <string.h>
-#include "Environment.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "AuctionPolicy.h"
+#include "Control.h"
+#include "Formations.h"
+#include "FrameWriter.h"
+#include "StateRing.h"
+#include "TripleBuffer.h"
+#ifndef HEADLESS
+#include "GLIncludes.h"
+#include "GLRenderer.h"
+#endif
 using namespace std;
 
 
@@ -34,7 +48,10 @@ bool parseArguments(GLint   argc,
                     GLint   &ins,
                     GLfloat &trans,
                     string  &randInput,
-                    GLint   &noGui);
+                    GLint   &noGui,
+                    string  &policy,
+                    string  &profile,
+                    string  &trace);
 bool validateParameters(const GLint   nRobots,
                         const GLint   fIndex,
                         const GLfloat fRadius,
@@ -45,10 +62,15 @@ void displayMenu();
 bool initEnv(const GLint nRobots, const GLint fIndex);
 bool deinitEnv();
 bool changeFormation(const GLint index);
+bool controlSimulation();
+void simulate();
+void startSimulation();
+void stopSimulation();
 
 
 
-// OpenGL function prototypes
+// OpenGL function prototypes (not built headless, see Makefile)
+#ifndef HEADLESS
 void initWindow();
 void display();
 void keyboardPress(unsigned char keyPressed, GLint mouseX, GLint mouseY);
@@ -59,31 +81,14 @@ void mouseClick(GLint mouseButton, GLint mouseState,
 void mouseDrag(GLint mouseX, GLint mouseY);
 void resizeWindow(GLsizei w, GLsizei h);
 void timerFunction(GLint value);
-
-
-
-// formation-testing function prototypes
-GLfloat  line(const GLfloat x);
-GLfloat  x(const GLfloat x);
-GLfloat  absX(const GLfloat x);
-GLfloat  negHalfX(const GLfloat x);
-GLfloat  negAbsHalfX(const GLfloat x);
-GLfloat  negAbsX(const GLfloat x);
-GLfloat  parabola(const GLfloat x);
-GLfloat  cubic(const GLfloat x);
-GLfloat  condSqrt(const GLfloat x);
-GLfloat  sine(const GLfloat x);
-GLfloat  xRoot3(const GLfloat x);
-GLfloat  negXRoot3(const GLfloat x);
-Function formations[] = {line,        x,       absX,     negHalfX,
-                         negAbsHalfX, negAbsX, parabola, cubic,
-                         condSqrt,    sine,    xRoot3,   negXRoot3};
+#endif
 
 
 
 // OpenGL global constants
 const GLint INIT_WINDOW_POSITION[2] = {0, 0};      // window offset
 const char  CHAR_ESCAPE             = char(27);    // 'ESCAPE' character key
+const GLint FRAME_INTERVAL          = 16;          // between frames (in ms)
 
 
 
@@ -91,6 +96,9 @@ const char  CHAR_ESCAPE             = char(27);    // 'ESCAPE' character key
 GLint   g_windowSize[2] = {800, 800};   // window size in pixels
 GLfloat g_windowWidth   = 2.0f;         // resized window width
 GLfloat g_windowHeight  = 2.0f;         // resized window height
+#ifndef HEADLESS
+GLRenderer g_renderer;                  // renders the environment
+#endif
 
 
 
@@ -120,6 +128,32 @@ GLint        g_ins           = 0;
 GLfloat      g_trans         = 0.02;
 string       randInput       = "randOut.txt";
 GLint        noGui           = 0;
+string       g_policy        = "";      // auction policy (see AuctionPolicy.h)
+string       g_profile       = "";      // step profile file (see Profiler.h)
+string       g_trace         = "";      // trace-event file (see Trace.h)
+GLint        g_maxSteps      = 0;       // headless step limit (0 = none)
+unsigned int g_seed          = 0;       // seed of rand() (0 = the time)
+string       g_trajectory    = "";      // trajectory file (headless only)
+string       g_frames        = "";      // frame file(s) (see FrameWriter.h)
+GLint        g_frameEvery    = 10;      // steps between frames
+string       g_control       = "";      // control socket (see Control.h)
+bool         g_paused        = false;   // by the control socket
+string       g_ring          = "";      // state ring (see StateRing.h)
+bool         g_discrete      = false;   // discrete message passing
+GLint        g_pauseSteps    = 0;       // steps left while paused
+volatile sig_atomic_t g_interrupted = 0;    // by ^C (see terminate())
+
+
+
+// simulation thread global variables (the simulation steps on its own
+// thread, publishing a snapshot of the environment after each step, which
+// is rendered by the GLUT thread; g_envMutex is held while the environment
+// is stepped or changed, i.e., by the input handlers)
+TripleBuffer<Snapshot> g_snapshots;
+mutex                  g_envMutex;
+thread                 g_simThread;
+atomic<bool>           g_simRunning(false);
+atomic<bool>           g_simDone(false);    // the simulation has finished
 
 
 
@@ -140,7 +174,7 @@ int main(GLint argc, char **argv)
 
     // parse command line arguments
     if (!parseArguments(argc, argv,
-                        g_nRobots, g_fIndex, g_fRadius, g_fHeading, g_dt,g_ins,g_trans,randInput,noGui))
+                        g_nRobots, g_fIndex, g_fRadius, g_fHeading, g_dt,g_ins,g_trans,randInput,noGui,g_policy,g_profile,g_trace))
     {
         cerr << ">> ERROR: Unable to parse arguments...\n\n";
         return 1;
@@ -153,14 +187,23 @@ int main(GLint argc, char **argv)
         return 1;
     }
 
+#ifdef HEADLESS
+    noGui = 1;    // there is no front end to render to
+#endif
+
+    // write log messages from a background thread (see Logger.h)
+    Logger::start();
+
     // create handler for interrupts (i.e., ^C)
     if (signal(SIGINT, SIG_IGN) != SIG_IGN) signal(SIGINT, terminate);
     signal(SIGPIPE, SIG_IGN);
 
     // use the GLUT utility to initialize the window, to handle
     // the input and to interact with the windows system
+#ifndef HEADLESS
     if(!noGui)
     {
+        Renderer::current = &g_renderer;
         glutInit(&argc, argv);
         glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA);
         glutInitWindowSize(g_windowSize[0], g_windowSize[1]);
@@ -169,15 +212,15 @@ int main(GLint argc, char **argv)
 
         // specify the resizing, refreshing, and interactive routines
         glutDisplayFunc(display);
-        glutIdleFunc(display);
         glutKeyboardFunc(keyboardPress);
         glutMouseFunc(mouseClick);
         glutMotionFunc(mouseDrag );
         glutReshapeFunc(resizeWindow);
         glutSpecialFunc(keyboardPressSpecial);
         glutSpecialUpFunc(keyboardReleaseSpecial);
-        glutTimerFunc(50, timerFunction, 1);
+        glutTimerFunc(FRAME_INTERVAL, timerFunction, 1);
     }
+#endif
     // initialize and execute the robot cell environment
     if (!initEnv(g_nRobots, g_fIndex))
     {
@@ -185,28 +228,64 @@ int main(GLint argc, char **argv)
         return 1;
     }
     g_env->formFromClick(0.0001,0.0001);
+    if ((!g_ring.empty()) && (!StateRing::open(g_ring, g_nRobots + 1)))
+        cerr << ">> ERROR: Unable to create state ring '"
+             << g_ring << "'...\n\n";
+    StateRing::publish(g_env);
+#ifndef HEADLESS
     if(!noGui)
     {
         initWindow();
         displayMenu();
+        startSimulation();
         glutMainLoop();
     }
+#endif
     if(noGui)
     {
-        while(g_env->step())
+        ofstream trajectory;
+        if (!g_trajectory.empty())
+        {
+            trajectory.open(g_trajectory.c_str());
+            if (!trajectory)
+                cerr << ">> ERROR: Unable to write trajectory '"
+                     << g_trajectory << "'...\n\n";
+            else g_env->writeTrajectory(trajectory);
+        }
+        if (!g_frames.empty())
+        {
+            if (!FrameWriter::open(g_frames, g_frameEvery))
+                cerr << ">> ERROR: Unable to write frames '"
+                     << g_frames << "'...\n\n";
+            else FrameWriter::capture(g_env);
+        }
+        if ((!g_control.empty()) && (!Control::open(g_control)))
+            cerr << ">> ERROR: Unable to listen on control socket '"
+                 << g_control << "'...\n\n";
+        while((!g_interrupted) &&
+              ((!Control::enabled) || (controlSimulation())) &&
+              (g_env->step()) &&
+              ((g_maxSteps <= 0) || (g_env->stepCount < g_maxSteps)))
         {
+            if (trajectory.is_open()) g_env->writeTrajectory(trajectory);
+            FrameWriter::capture(g_env);
+            StateRing::publish(g_env);
         }
-        g_env->writeFinalPositions();
-        g_env->writeDistanceData("out.out","distances.out");
-        g_env->writeHeader();
+        if (trajectory.is_open()) trajectory.close();
+        if (!g_interrupted)
+        {
+            g_env->writeFinalPositions();
+            g_env->writeDistanceData("out.out","distances.out");
+            g_env->writeHeader();
 
-        g_env->dumpMessagesToFile("messages.out");
-        g_env->dumpErrorToFile("errors.out");
+            g_env->dumpMessagesToFile("messages.out");
+            g_env->dumpErrorToFile("errors.out");
+        }
     }
 
     deinitEnv();
 
-    return 0;
+    return g_interrupted;
 }   // main(GLint, char **)
 
 
@@ -230,6 +309,18 @@ void printUsage(GLint argc, char **argv)
          << " [-r <fRadius>]"
          << " [-h <fHeading>]"
          << " [-t <dT>]"
+         << " [-a <policy>]"
+         << " [-p <profile>]"
+         << " [-T <trace>]"
+         << " [-b <budget>]"
+         << " [-l <level>[:<categories>]]"
+         << " [-m <maxSteps>]"
+         << " [-S <seed>]"
+         << " [-o <trajectory>]"
+         << " [-F <frames>]"
+         << " [-k <every>]"
+         << " [-C <socket>]"
+         << " [-M <name>]"
          << endl
          << "      -n <nRobots>: number of robots"
          << " [0, MAX_N_ROBOTS] (DEFAULT=19)"        << endl
@@ -251,8 +342,52 @@ void printUsage(GLint argc, char **argv)
          << "      -h <fHeading>: formation heading"
          << " (in degrees; default=90.0)"            << endl
          << "      -t <dt>: update time interval"
-         << " [1, ??] (in milliseconds; default=50)"
-         << endl;
+         << " [0, ??] (in milliseconds; 0 = as fast as possible;"
+         << " default=50)" << endl
+         << "      -a <policy>: auction policy"
+         << " (default=push, or insertion with -i):"  << endl;
+    for (GLint i = 0; i < N_AUCTION_POLICIES; ++i)
+        cout << "             " << AUCTION_POLICIES[i].name << endl;
+    cout << "      -p <profile>: profile each step phase, written at exit"
+         << " (.json for JSON, CSV otherwise)" << endl
+         << "      -T <trace>: write trace-event JSON (for a trace viewer)"
+         << endl
+         << "      -b <budget>: report step latency at exit, dumping the"
+         << " last " << FLIGHT_RECORDER_STEPS << " steps" << endl
+         << "             to " << FLIGHT_RECORDER_FILE
+         << " when a step exceeds <budget> ms (0 = never)" << endl
+         << "      -l <level>[:<categories>]: log level"
+         << " (trace, debug, info, warn, error, off; default=info)" << endl
+         << "             and categories (env, cell, robot, auction,"
+         << " formation; default=all)" << endl
+         << "      -m <maxSteps>: stop a headless (-g) run after <maxSteps>"
+         << " steps (default=0, until quiescence)" << endl
+         << "      -S <seed>: seed of the random number generator, making"
+         << " the run reproducible" << endl
+         << "             (default=0, seeded from the time)" << endl
+         << "      -o <trajectory>: write the position and heading of every"
+         << " cell and robot" << endl
+         << "             at every step of a headless (-g) run" << endl
+         << "      -F <frames>: write a frame of a headless (-g) run"
+         << " every <every> steps, as" << endl
+         << "             PNG files (<frames> ending in .png, numbered by"
+         << " a %d or after it)" << endl
+         << "             or a raw RGB24 " << FRAME_WIDTH << "x"
+         << FRAME_HEIGHT << " video stream (otherwise)" << endl
+         << "      -k <every>: steps between frames (default=10)" << endl
+         << "      -C <socket>: monitor and drive a headless (-g) run through"
+         << " a Unix-domain socket" << endl
+         << "             (metrics; formation, heading, radius, seed, pause,"
+         << " resume, step," << endl
+         << "             snapshot, metrics, and quit commands)" << endl
+         << "      -M <name>: publish the state of every cell and robot after"
+         << " each step" << endl
+         << "             to the shared-memory state ring <name>"
+         << " (see support/ringdump)" << endl
+         << "      -D: deliver the packets sent during a step at the start of"
+         << " the next step" << endl
+         << "             (discrete message passing; default=as they are"
+         << " sent)" << endl;
 }   // printUsage(GLint, char **)
 
 
@@ -284,7 +419,10 @@ bool parseArguments(GLint    argc,
                     GLint   &ins,
                     GLfloat &trans,
                     string  &randInput,
-                    GLint   &noGui)
+                    GLint   &noGui,
+                    string  &policy,
+                    string  &profile,
+                    string  &trace)
 {
     int i = 0;
     while (++i < argc)
@@ -349,6 +487,128 @@ bool parseArguments(GLint    argc,
             else
             {
                 cout << "failed to parse translational error argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-a", 2))
+        {
+            if((++i < argc) && (findAuctionPolicy(argv[i]) != NULL))
+            {
+                policy = argv[i];
+            }
+            else
+            {
+                cout << "failed to parse auction policy argument." << endl;
+                printUsage(argc, argv);
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-p", 2))
+        {
+            if(++i < argc)
+            {
+                profile = argv[i];
+                Profiler::enable(true);
+            }
+            else
+            {
+                cout << "failed to parse profile argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-T", 2))
+        {
+            if((++i < argc) && (Trace::open(argv[i])))
+            {
+                trace = argv[i];
+            }
+            else
+            {
+                cout << "failed to parse (or open) trace argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-b", 2))
+        {
+            if((++i < argc) && (atof(argv[i]) >= 0.0))
+            {
+                FlightRecorder::enable(atof(argv[i]) / 1000.0);
+            }
+            else
+            {
+                cout << "failed to parse step budget argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-l", 2))
+        {
+            if((++i >= argc) || (!Logger::parse(argv[i])))
+            {
+                cout << "failed to parse log argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-m", 2))
+        {
+            if((++i >= argc) || ((g_maxSteps = atoi(argv[i])) < 0))
+            {
+                cout << "failed to parse max steps argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-S", 2))
+        {
+            if((++i >= argc) || (sscanf(argv[i], "%u", &g_seed) != 1))
+            {
+                cout << "failed to parse random seed argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-o", 2))
+        {
+            if(++i < argc) g_trajectory = argv[i];
+            else
+            {
+                cout << "failed to parse trajectory argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-F", 2))
+        {
+            if(++i < argc) g_frames = argv[i];
+            else
+            {
+                cout << "failed to parse frames argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-k", 2))
+        {
+            if((++i >= argc) || ((g_frameEvery = atoi(argv[i])) <= 0))
+            {
+                cout << "failed to parse frame interval argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-C", 2))
+        {
+            if(++i < argc) g_control = argv[i];
+            else
+            {
+                cout << "failed to parse control socket argument." << endl;
+                return false;
+            }
+        }
+        else if(!strncmp(argv[i], "-D", 2))
+        {
+            g_discrete = true;
+        }
+        else if(!strncmp(argv[i], "-M", 2))
+        {
+            if(++i < argc) g_ring = argv[i];
+            else
+            {
+                cout << "failed to parse state ring argument." << endl;
                 return false;
             }
         }
@@ -423,10 +683,10 @@ bool validateParameters(const GLint   nRobots,
     }
 
     // validate the time interval
-    if (dt < 1)
+    if (dt < 0)
     {
         cout << "Parameter: "
-             << "'dt' must be greater than 1." << endl;
+             << "'dt' must be non-negative." << endl;
         valid = false;
     }
 
@@ -437,9 +697,11 @@ bool validateParameters(const GLint   nRobots,
 
 //
 // void terminate(retVal)
-// Last modified: 08Nov2009
+// Last modified: 19Oct2026
 //
-// Terminates the program on interrupt (i.e., ^C).
+// Terminates the program on interrupt (i.e., ^C) by flagging it, so that
+// the run shuts down normally once it sees the flag (as a signal handler
+// may not lock, wait, or join).
 //
 // Returns:     <none>
 // Parameters:
@@ -447,10 +709,7 @@ bool validateParameters(const GLint   nRobots,
 //
 void terminate(int retVal)
 {
-    signal(SIGINT, SIG_IGN);
-    deinitEnv();
-    signal(SIGINT, SIG_DFL);
-    exit(retVal);
+    g_interrupted = retVal;
 }   // terminate(int)
 
 
@@ -563,7 +822,10 @@ bool initEnv(const GLint nRobots, const GLint fIndex)
 
     Formation f(formations[fIndex], g_fRadius, Vector(),
                 g_sID,            ++g_fID,     g_fHeading);
-    return (g_env = new Environment(nRobots, f,DEFAULT_ENV_COLOR,g_ins,g_trans,randInput)) != NULL;
+    if ((g_env = new Environment(nRobots, f,DEFAULT_ENV_COLOR,g_ins,g_trans,randInput,g_policy,g_seed)) == NULL)
+        return false;
+    g_env->setDiscrete(g_discrete);
+    return true;
 }   // initEnv(const GLint, const GLint)
 
 
@@ -580,6 +842,17 @@ bool initEnv(const GLint nRobots, const GLint fIndex)
 //
 bool deinitEnv()
 {
+    stopSimulation();
+    Logger::stop();
+    if ((!g_profile.empty()) && (!Profiler::write(g_profile)))
+        cerr << ">> ERROR: Unable to write profile '" << g_profile << "'...\n\n";
+    if ((!g_trace.empty()) && (Trace::enabled) && (!Trace::close()))
+        cerr << ">> ERROR: Unable to write trace '" << g_trace << "'...\n\n";
+    if ((FrameWriter::enabled) && (!FrameWriter::close()))
+        cerr << ">> ERROR: Unable to write frames '" << g_frames << "'...\n\n";
+    if (Control::enabled) Control::close();
+    if (StateRing::enabled) StateRing::close();
+    if (FlightRecorder::enabled) FlightRecorder::report();
     if (g_env != NULL)
     {
         delete g_env;
@@ -622,6 +895,203 @@ bool changeFormation(const GLint index)
 
 
 
+//
+// bool controlSimulation()
+// Last modified: 19Oct2026
+//
+// Applies the commands received through the control socket (see
+// Control.h), waiting while the simulation is paused, returning true if
+// the environment should be stepped, false if the run should finish.
+//
+// Returns:     true if the environment should be stepped, false otherwise
+// Parameters:  <none>
+//
+bool controlSimulation()
+{
+    while (true)
+    {
+        if (g_interrupted) return false;
+        vector<ControlCommand> commands;
+        Control::poll(g_env, commands,
+                      ((g_paused) && (g_pauseSteps == 0)) ?
+                      CONTROL_METRICS_INTERVAL : 0);
+        for (size_t i = 0; i < commands.size(); ++i)
+        {
+            ControlCommand &c = commands[i];
+            ostringstream   reply;
+            reply << "ok";
+            if ((g_env->getNCells() == 0) &&
+                ((c.type == CONTROL_FORMATION) || (c.type == CONTROL_HEADING) ||
+                 (c.type == CONTROL_RADIUS)))
+            {
+                Control::reply(c.client, "error no formation yet");
+                continue;
+            }
+            switch (c.type)
+            {
+                case CONTROL_FORMATION:
+                    if ((c.value < 0.0f) || (c.value > 9.0f))
+                    {
+                        reply.str("error formation index [0, 9]");
+                        break;
+                    }
+                    changeFormation((GLint)c.value);
+                    break;
+                case CONTROL_HEADING:
+                    g_fHeading = scaleDegrees(c.value);
+                    changeFormation(g_fIndex);
+                    break;
+                case CONTROL_RADIUS:
+                    g_fRadius = max(c.value,
+                                    g_env->getCell(g_sID)->collisionRadius());
+                    changeFormation(g_fIndex);
+                    break;
+                case CONTROL_SEED:
+                    if (g_env->getCell((GLint)c.value) == NULL)
+                    {
+                        reply.str("error no such cell");
+                        break;
+                    }
+                    g_selectedIndex = (GLint)c.value;
+                    break;
+                case CONTROL_PAUSE:
+                    g_paused     = true;
+                    g_pauseSteps = 0;
+                    break;
+                case CONTROL_RESUME:
+                    g_paused = false;
+                    break;
+                case CONTROL_STEP:
+                    if (c.value < 1.0f)
+                    {
+                        reply.str("error step count >= 1");
+                        break;
+                    }
+                    g_paused      = true;
+                    g_pauseSteps += (GLint)c.value;
+                    break;
+                case CONTROL_SNAPSHOT:
+                {
+                    ostringstream trajectory;
+                    g_env->writeTrajectory(trajectory);
+                    string lines = trajectory.str();
+                    if (!lines.empty()) lines.erase(lines.size() - 1);
+                    reply << " snapshot step=" << g_env->stepCount << endl
+                          << lines << endl << "end";
+                    break;
+                }
+                case CONTROL_METRICS:
+                    Control::sendMetrics(g_env, c.client);
+                    continue;
+                case CONTROL_QUIT:
+                    Control::reply(c.client, reply.str());
+                    return false;
+                case CONTROL_ERROR:
+                    reply.str("error unknown command '" + c.line + "'");
+                    break;
+            }
+            Control::reply(c.client, reply.str());
+        }
+        if ((!g_paused) || (g_pauseSteps > 0)) break;
+    }
+    if (g_paused) --g_pauseSteps;
+    return true;
+}   // controlSimulation()
+
+
+
+//
+// void simulate()
+// Last modified: 19Oct2026
+//
+// Steps the environment (every g_dt milliseconds, or as fast as possible
+// if g_dt is 0) until it is stopped or finishes, publishing a snapshot of
+// the environment after each step (run on the simulation thread).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void simulate()
+{
+    chrono::steady_clock::time_point next = chrono::steady_clock::now();
+    while (g_simRunning.load())
+    {
+        {
+            lock_guard<mutex> lock(g_envMutex);
+            if (!g_env->step())
+            {
+                g_env->writeFinalPositions();
+                g_env->writeDistanceData("out.out","distances.out");
+                g_env->writeHeader();
+
+                g_env->dumpMessagesToFile("messages.out");
+                g_env->dumpErrorToFile("errors.out");
+                g_simDone.store(true);
+            }
+            g_env->capture(g_snapshots.getBack());
+            StateRing::publish(g_env);
+        }
+        g_snapshots.publish();
+        if (g_simDone.load()) break;
+        if (g_dt > 0)
+        {
+            next += chrono::milliseconds(g_dt);
+            this_thread::sleep_until(next);
+        }
+    }
+}   // simulate()
+
+
+
+//
+// void startSimulation()
+// Last modified: 19Oct2026
+//
+// Starts stepping the environment on the simulation thread.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void startSimulation()
+{
+    if (g_simRunning.load()) return;
+    {
+        lock_guard<mutex> lock(g_envMutex);
+        g_env->capture(g_snapshots.getBack());
+    }
+    g_snapshots.publish();
+    g_simRunning.store(true);
+
+    // interrupts (i.e., ^C) are handled by the GLUT thread (see terminate())
+    sigset_t interrupt, previous;
+    sigemptyset(&interrupt);
+    sigaddset(&interrupt, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &interrupt, &previous);
+    g_simThread = thread(simulate);
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+}   // startSimulation()
+
+
+
+//
+// void stopSimulation()
+// Last modified: 19Oct2026
+//
+// Stops stepping the environment, waiting for the simulation thread
+// to finish its step.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+void stopSimulation()
+{
+    g_simRunning.store(false);
+    if (g_simThread.joinable()) g_simThread.join();
+}   // stopSimulation()
+
+
+
+#ifndef HEADLESS
 //
 // void initWindow()
 // Last modified:   08Nov2009
@@ -660,12 +1130,11 @@ void display()
     glClear(GL_COLOR_BUFFER_BIT);   // clear background color
     glMatrixMode(GL_MODELVIEW);     // modeling transformation
 
-    // draws environment robot cells
-    if (g_env->getCells().size() > 0)
-    {
-        g_env->getCell(g_sID)->setColor(GREEN);
-    }
-    g_env->draw();
+    // draws the latest snapshot of the environment robot cells
+    g_snapshots.update();
+    g_renderer.beginFrame();        // batch the robots (see GLRenderer.h)
+    g_renderer.drawSnapshot(g_snapshots.getFront());
+    g_renderer.endFrame();
 
     glFlush();                      // force the execution of OpenGL commands
     glutSwapBuffers();              // swap visible buffer and writing buffer
@@ -687,6 +1156,19 @@ void display()
 //
 void keyboardPress(unsigned char keyPressed, GLint mouseX, GLint mouseY)
 {
+    if (keyPressed == CHAR_ESCAPE)
+    {
+        stopSimulation();
+        g_env->writeDistanceData("out.out","distances.out");
+        g_env->writeHeader();
+
+        g_env->dumpMessagesToFile("messages.out");
+        g_env->dumpErrorToFile("errors.out");
+
+        deinitEnv();
+        exit(0);
+    }
+    lock_guard<mutex> lock(g_envMutex);
     if ((keyPressed >= '0') && (keyPressed <= '9'))
     {
         if (g_env->getNCells() > 0)
@@ -763,17 +1245,6 @@ void keyboardPress(unsigned char keyPressed, GLint mouseX, GLint mouseY)
                 g_env->showHead(!g_env->getCell(g_sID)->heading.showHead);
             }
             break;
-        case CHAR_ESCAPE:
-            {
-                g_env->writeDistanceData("out.out","distances.out");
-                g_env->writeHeader();
-
-                g_env->dumpMessagesToFile("messages.out");
-                g_env->dumpErrorToFile("errors.out");
-
-                deinitEnv();
-                exit(0);
-            }
     }
 }   // keyboardPress(unsigned char, GLint, GLint)
 
@@ -793,6 +1264,7 @@ void keyboardPress(unsigned char keyPressed, GLint mouseX, GLint mouseY)
 //
 void keyboardPressSpecial(GLint keyPressed, GLint mouseX, GLint mouseY)
 {
+    lock_guard<mutex> lock(g_envMutex);
     switch (keyPressed)
     {
         case GLUT_KEY_LEFT:
@@ -851,6 +1323,7 @@ void keyboardPressSpecial(GLint keyPressed, GLint mouseX, GLint mouseY)
 //
 void keyboardReleaseSpecial(GLint keyReleased, GLint mouseX, GLint mouseY)
 {
+    lock_guard<mutex> lock(g_envMutex);
     switch (keyReleased)
     {
         case GLUT_KEY_LEFT: case GLUT_KEY_RIGHT:
@@ -887,6 +1360,7 @@ void keyboardReleaseSpecial(GLint keyReleased, GLint mouseX, GLint mouseY)
 void mouseClick(GLint mouseButton,    GLint mouseState,
                 GLint mouseX, GLint mouseY)
 {
+    lock_guard<mutex> lock(g_envMutex);
 	GLint mod = glutGetModifiers();
     if (mouseState == GLUT_DOWN)
     {
@@ -983,6 +1457,7 @@ void mouseClick(GLint mouseButton,    GLint mouseState,
 //
 void mouseDrag(GLint mouseX, GLint mouseY)
 {
+    lock_guard<mutex> lock(g_envMutex);
     if (g_env->getNCells() > 0)
     {
         if (g_selectedIndex != ID_NO_NBR)
@@ -1028,6 +1503,8 @@ void resizeWindow(GLsizei w, GLsizei h)
         g_windowHeight = 2.0f * (GLfloat)h / (GLfloat)w;
         glOrtho(-1.0f, 1.0f, -1.0f * (GLfloat)h / (GLfloat)w,
                 (GLfloat)h / (GLfloat)w, -10.0f, 10.0f);
+        g_renderer.setView(-1.0f, 1.0f, -1.0f * (GLfloat)h / (GLfloat)w,
+                           (GLfloat)h / (GLfloat)w, w, h);
     }
     else
     {
@@ -1036,6 +1513,8 @@ void resizeWindow(GLsizei w, GLsizei h)
         glOrtho(-1.0f * (GLfloat)w / (GLfloat)h,
                 (GLfloat)w / (GLfloat)h,
                 -1.0f, 1.0f, -10.0f, 10.0f);
+        g_renderer.setView(-1.0f * (GLfloat)w / (GLfloat)h,
+                           (GLfloat)w / (GLfloat)h, -1.0f, 1.0f, w, h);
     }
     glutPostRedisplay();            // redraw the scene
 }   // resizeWindow(GLsizei, GLsizei)
@@ -1044,9 +1523,10 @@ void resizeWindow(GLsizei w, GLsizei h)
 
 //
 // void timerFunction(value)
-// Last modified:   08Nov2009
+// Last modified:   19Oct2026
 //
-// Updates the environment and redraws.
+// Redraws (the latest snapshot of) the environment every frame,
+// exiting once the simulation has finished (or is interrupted).
 //
 // Returns:     <none>
 // Parameters:
@@ -1054,229 +1534,14 @@ void resizeWindow(GLsizei w, GLsizei h)
 //
 void timerFunction(GLint value)
 {
-    if(!g_env->step())
+    if ((g_simDone.load()) || (g_interrupted))
     {
-        g_env->writeFinalPositions();
-        g_env->writeDistanceData("out.out","distances.out");
-        g_env->writeHeader();
-
-        g_env->dumpMessagesToFile("messages.out");
-        g_env->dumpErrorToFile("errors.out");
         deinitEnv();
-        exit(0);
-    }          // update the robot cell environment
+        exit(g_interrupted);
+    }
 
     // force a redraw after a number of milliseconds
     glutPostRedisplay();    // redraw the scene
-    glutTimerFunc(g_dt, timerFunction, 1);
+    glutTimerFunc(FRAME_INTERVAL, timerFunction, 1);
 }   // timerFunction(GLint)
-
-
-
-// <test formation functions>
-
-//
-// GLfloat line(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = 0.
-//
-// Returns:     f(x) = 0
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat line(const GLfloat x)
-{
-    return 0.0f;
-}   // line(const GLfloat)
-
-
-
-//
-// GLfloat x(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = x.
-//
-// Returns:     f(x) = x
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat x(const GLfloat x)
-{
-    return x;
-}   // x(const GLfloat)
-
-
-
-//
-// GLfloat absX(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = |x|.
-//
-// Returns:     f(x) = |x|
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat absX(const GLfloat x)
-{
-    return abs(x);
-}   // absX(const GLfloat)
-
-
-
-//
-// GLfloat negHalfX(x)
-// Last modified:   07Jan2007
-//
-// Returns formation function definition f(x) = -0.5 x.
-//
-// Returns:     f(x) = -0.5 x
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat negHalfX(const GLfloat x)
-{
-    return -0.5f * x;
-}   // negHalfX(const GLfloat)
-
-
-
-//
-// GLfloat negAbsHalfX(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = -|0.5 x|.
-//
-// Returns:     f(x) = -|0.5 x|
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat negAbsHalfX(const GLfloat x)
-{
-    return -abs(0.5f * x);
-}   // negAbsHalfX(const GLfloat)
-
-
-
-//
-// GLfloat negAbsX(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = -|x|.
-//
-// Returns:     f(x) = -|x|
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat negAbsX(const GLfloat x)
-{
-    return -abs(x);
-}   // negAbsX(const GLfloat)
-
-
-
-//
-// GLfloat parabola(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = x^2.
-//
-// Returns:     f(x) = x^2
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat parabola(const GLfloat x)
-{
-	return x * x;
-    //return pow(x, 2.0f);
-}   // parabola(const GLfloat)
-
-
-
-//
-// GLfloat cubic(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = x^3.
-//
-// Returns:     f(x) = x^3
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat cubic(const GLfloat x)
-{
-	return x * x * x;
-    //return pow(x, 3.0f);
-}   // cubic(const GLfloat)
-
-
-
-//
-// GLfloat condSqrt(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition
-// f(x) = {sqrt(x),  x = 0 | -sqrt|x|, x < 0}.
-//
-// Returns:     f(x) = {sqrt(x),  x = 0 | -sqrt|x|, x < 0}
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat condSqrt(const GLfloat x)
-{
-    return sqrt(abs(0.5f * x)) * ((x >= 0) ? 1.0f : -1.0f);
-}   // condSqrt(const GLfloat)
-
-
-
-//
-// GLfloat sine(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = 0.05 sin(10 x).
-//
-// Returns:     f(x) = 0.05 sin(10 x)
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat sine(const GLfloat x)
-{
-    //0.1 is max amplitude
-    return 0.1f * sin(10.0f * x);
-}   // sine(const GLfloat)
-
-
-
-//
-// GLfloat xRoot3(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = x sqrt(3).
-//
-// Returns:     f(x) = x sqrt(3)
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat xRoot3(const GLfloat x)
-{
-    return x * sqrt(3.0f);
-}   // xRoot3(const GLfloat)
-
-
-
-//
-// GLfloat negXRoot3(x)
-// Last modified:   04Sep2006
-//
-// Returns formation function definition f(x) = -x sqrt(3).
-//
-// Returns:     f(x) = -x sqrt(3)
-// Parameters:
-//      x       in      used to evaluate the function
-//
-GLfloat negXRoot3(const GLfloat x)
-{
-    return -x * sqrt(3.0f);
-}   // negXRoot3(const GLfloat)
+#endif
@@ -0,0 +1,52 @@
+//
+// Filename:        "Snapshot.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This structure implements a snapshot of the environment.
+//
+
+// preprocessor directives
+#include "Snapshot.h"
+
+
+
+// <constructors>
+
+//
+// RobotSnapshot(r)
+// Last modified: 19Oct2026
+//
+// Constructor that captures what is rendered of the parameterized robot,
+// placing its heading on it (as a robot renders its heading).
+//
+// Returns:     <none>
+// Parameters:
+//      r       in      the robot being captured
+//
+RobotSnapshot::RobotSnapshot(const Robot &r)
+    : body(r), heading(r.heading), showHeading(r.showHeading)
+{
+    body.showFilled = r.showFilled;
+    heading.translated(r.x + r.translate[0],
+                       r.y + r.translate[1],
+                       r.z + r.translate[2]);
+    heading.scaled(r.getRadius() / DEFAULT_ROBOT_RADIUS);
+    heading.setColor(r.color);
+}   // RobotSnapshot(const Robot &)
+
+
+
+//
+// Snapshot()
+// Last modified: 19Oct2026
+//
+// Default constructor that initializes this snapshot (empty).
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+Snapshot::Snapshot(): stepCount(0)
+{
+    color[0] = color[1] = color[2] = 0.0f;
+}   // Snapshot()
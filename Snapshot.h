@@ -0,0 +1,50 @@
+//
+// Filename:        "Snapshot.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This structure describes a snapshot of the environment,
+//                  i.e., what is rendered of each cell and [free] robot at
+//                  a step, captured by the simulation so that a front end
+//                  may render it (on another thread) while the simulation
+//                  steps on (see TripleBuffer.h).
+//
+
+// preprocessor directives
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include <vector>
+#include "Cell.h"
+using namespace std;
+
+
+
+// describes what is rendered of a robot at a step
+struct RobotSnapshot
+{
+
+    // <data members>
+    Circle body;           // position, radius, color, and display settings
+    Vector heading;        // heading, placed on the body
+    bool   showHeading;
+
+    // <constructors>
+    RobotSnapshot(const Robot &r);
+};  // RobotSnapshot
+
+
+
+// describes what is rendered of the environment at a step
+struct Snapshot
+{
+
+    // <data members>
+    GLint                 stepCount;
+    GLfloat               color[3];  // background color of the environment
+    vector<RobotSnapshot> robots;    // cells, then [free] robots
+
+    // <constructors>
+    Snapshot();
+};  // Snapshot
+
+#endif
@@ -0,0 +1,136 @@
+//
+// Filename:        "StateRing.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the state ring of the simulation.
+//
+
+// preprocessor directives
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "Environment.h"
+#include "StateRing.h"
+
+
+
+// <static data members>
+bool StateRing::enabled = false;
+
+
+
+// state ring global variables
+static RingHeader *g_header = NULL;    // (mapped)
+static size_t      g_size   = 0;       // of the mapping, in bytes
+static string      g_name   = "";
+
+
+
+// <public static mutator functions>
+
+//
+// bool open(name, maxEntities)
+// Last modified: 19Oct2026
+//
+// Attempts to create (or replace) the shared-memory object with the
+// parameterized name (e.g., "/swarm") as a state ring whose slots hold
+// the parameterized number of entities, returning true if successful,
+// false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      name        in      the name of the shared-memory object
+//      maxEntities in      the number of entities of a slot
+//
+bool StateRing::open(const string &name, const GLint maxEntities)
+{
+    if (enabled) close();
+    if (maxEntities < 0) return false;
+    g_name = (name[0] == '/') ? name : "/" + name;
+    size_t slotSize = sizeof(RingSlot) + maxEntities * sizeof(RingEntity);
+    g_size = sizeof(RingHeader) + RING_N_SLOTS * slotSize;
+
+    int fd = shm_open(g_name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    bool success = ftruncate(fd, g_size) == 0;
+    void *p      = success ? mmap(NULL, g_size, PROT_READ | PROT_WRITE,
+                                  MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (p == MAP_FAILED)
+    {
+        shm_unlink(g_name.c_str());
+        return false;
+    }
+
+    // initialize the header and slots (readers check the magic last)
+    g_header              = (RingHeader *)p;
+    g_header->version     = RING_VERSION;
+    g_header->nSlots      = RING_N_SLOTS;
+    g_header->maxEntities = maxEntities;
+    g_header->slotSize    = slotSize;
+    g_header->latest.store(0, memory_order_relaxed);
+    for (GLint i = 0; i < RING_N_SLOTS; ++i)
+    {
+        RingSlot *slot = (RingSlot *)((char *)(g_header + 1) + i * slotSize);
+        slot->sequence.store(0, memory_order_relaxed);
+        slot->stepCount = 0;
+        slot->nEntities = 0;
+    }
+    atomic_thread_fence(memory_order_release);
+    g_header->magic = RING_MAGIC;
+    enabled         = true;
+    return true;
+}   // open(const string &, const GLint)
+
+
+
+//
+// bool close()
+// Last modified: 19Oct2026
+//
+// Attempts to unmap and remove the shared-memory object (readers that
+// have mapped it keep it until they unmap it), returning true if
+// successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool StateRing::close()
+{
+    if (!enabled) return false;
+    enabled      = false;
+    bool success = munmap(g_header, g_size) == 0;
+    g_header     = NULL;
+    return (shm_unlink(g_name.c_str()) == 0) && (success);
+}   // close()
+
+
+
+//
+// void publish(env)
+// Last modified: 19Oct2026
+//
+// Publishes the state of the parameterized environment into the next
+// slot of the state ring.
+//
+// Returns:     <none>
+// Parameters:
+//      env     in      the environment being published
+//
+void StateRing::publish(Environment *env)
+{
+    if ((!enabled) || (env == NULL)) return;
+    uint64_t  n    = g_header->latest.load(memory_order_relaxed) + 1;
+    RingSlot *slot = (RingSlot *)((char *)(g_header + 1) +
+                                  (n % g_header->nSlots) * g_header->slotSize);
+
+    // mark the slot as being written, write it, then mark it as written
+    slot->sequence.store(2 * n - 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->stepCount = env->stepCount;
+    slot->nEntities = env->exportState((RingEntity *)(slot + 1),
+                                       g_header->maxEntities);
+    slot->sequence.store(2 * n, memory_order_release);
+    g_header->latest.store(n, memory_order_release);
+}   // publish(Environment *)
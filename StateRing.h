@@ -0,0 +1,132 @@
+//
+// Filename:        "StateRing.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the state ring of the simulation,
+//                  a POSIX shared-memory object (e.g., /dev/shm/<name>)
+//                  into which the simulation publishes the state of each
+//                  cell and [free] robot after each step, so that external
+//                  processes (viewers, plotting scripts, monitors) may read
+//                  the live world (read-only) without the simulation
+//                  serializing it or waiting for them.  The object is a
+//                  RingHeader followed by RING_N_SLOTS slots, each a
+//                  RingSlot followed by up to maxEntities RingEntity's.
+//                  The n-th state published (from 1) is written to slot
+//                  n % nSlots, guarded by its sequence counter (a seqlock),
+//                  which is odd while the slot is being written and 2 n
+//                  after.  A reader takes n = latest, reads the slot's
+//                  sequence (2 n, or the slot is being rewritten), copies
+//                  the slot, and rereads the sequence; the copy is
+//                  consistent if the sequence has not changed (see
+//                  support/ringdump.cpp).
+//
+
+// preprocessor directives
+#ifndef STATE_RING_H
+#define STATE_RING_H
+#include <atomic>
+#include <stdint.h>
+#include <string>
+#include "GLTypes.h"
+using namespace std;
+
+
+
+// state ring settings
+#define RING_MAGIC         (0x474e4952)    // "RING" (little-endian)
+#define RING_VERSION       (1)
+#define RING_N_SLOTS       (8)
+#define RING_NO_NBR        (-1)            // the neighbor ID of none
+
+
+
+// enumerated flags of the entities of the state ring
+enum RingFlag
+{
+    RING_CELL         = 1,    // a cell of the formation (else a free robot)
+    RING_SEED         = 2,    // the seed of the formation
+    RING_SHOW_HEADING = 4     // rendered with its heading
+};  // RingFlag
+
+
+
+// describes the header of the state ring
+struct RingHeader
+{
+    uint32_t              magic;          // RING_MAGIC
+    uint32_t              version;        // RING_VERSION
+    uint32_t              nSlots;
+    uint32_t              maxEntities;    // of a slot
+    uint64_t              slotSize;       // in bytes (with its entities)
+    std::atomic<uint64_t> latest;         // states published (0 = none)
+};  // RingHeader
+
+
+
+// describes a slot of the state ring (followed by its entities)
+struct RingSlot
+{
+    std::atomic<uint64_t> sequence;      // odd while written, else 2 n
+    int32_t               stepCount;     // of the environment
+    uint32_t              nEntities;     // cells, then [free] robots
+};  // RingSlot
+
+
+
+// describes a cell or [free] robot in a slot of the state ring
+struct RingEntity
+{
+    float    x, y, heading;              // heading in degrees
+    float    radius;
+    int32_t  id;
+    int32_t  leftNbr, rightNbr;          // IDs of the neighbors of a cell
+    uint32_t flags;                      // (see RingFlag)
+    uint32_t color;                      // 0xRRGGBB
+};  // RingEntity
+
+
+
+//
+// uint32_t packColor(clr)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized color as 0xRRGGBB.
+//
+// Returns:     the color as 0xRRGGBB
+// Parameters:
+//      clr     in      the color being packed
+//
+inline uint32_t packColor(const GLfloat clr[3])
+{
+    uint32_t packed = 0;
+    for (GLint i = 0; i < 3; ++i)
+    {
+        GLfloat c = (clr[i] < 0.0f) ? 0.0f : (clr[i] > 1.0f) ? 1.0f : clr[i];
+        packed    = (packed << 8) | (uint32_t)(c * 255.0f + 0.5f);
+    }
+    return packed;
+}   // packColor(const GLfloat [])
+
+
+
+// forward declaration of a robot cell environment
+class Environment;
+
+
+
+// describes the (process-wide) state ring
+class StateRing
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static bool open(const string &name, const GLint maxEntities);
+        static bool close();
+        static void publish(Environment *env);
+};  // StateRing
+
+#endif
@@ -0,0 +1,192 @@
+//
+// Filename:        "Trace.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements the trace-event writer of the
+//                  simulation.
+//
+
+// preprocessor directives
+#include <iomanip>
+#include "Profiler.h"
+#include "Trace.h"
+
+
+
+// <static data members>
+bool     Trace::enabled = false;
+ofstream Trace::os;
+double   Trace::origin  = 0.0;
+bool     Trace::first   = true;
+
+
+
+// <public static mutator functions>
+
+//
+// bool open(filename)
+// Last modified: 19Oct2026
+//
+// Attempts to start tracing to the parameterized file,
+// returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the trace file
+//
+bool Trace::open(const string &filename)
+{
+    if (enabled) close();
+    os.open(filename.c_str());
+    if (!os) return false;
+    os << setiosflags(ios::fixed) << setprecision(3);
+    os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << endl;
+    origin  = Profiler::now();
+    first   = true;
+    enabled = true;
+    return true;
+}   // open(const string &)
+
+
+
+//
+// bool close()
+// Last modified: 19Oct2026
+//
+// Attempts to finish the trace file, returning true if successful,
+// false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Trace::close()
+{
+    if (!enabled) return false;
+    enabled = false;
+    os << endl << "]}" << endl;
+    bool success = os.good();
+    os.close();
+    return success;
+}   // close()
+
+
+
+//
+// void span(name, start, end)
+// Last modified: 19Oct2026
+//
+// Writes a complete event (a span) with the parameterized name,
+// start time, and end time (from Profiler::now()).
+//
+// Returns:     <none>
+// Parameters:
+//      name    in      the name of the span
+//      start   in      the start time of the span
+//      end     in      the end time of the span
+//
+void Trace::span(const char *name, const double start, const double end)
+{
+    if (!enabled) return;
+    beginEvent(name, "step", "X", start);
+    os << ", \"dur\": " << toMicros(end) - toMicros(start) << "}";
+}   // span(const char *, const double, const double)
+
+
+
+//
+// void instant(name, cat, key1, value1, key2, value2)
+// Last modified: 19Oct2026
+//
+// Writes an instant event with the parameterized name, category,
+// and (one or two) arguments, at the current time.
+//
+// Returns:     <none>
+// Parameters:
+//      name    in      the name of the event
+//      cat     in      the category of the event
+//      key1    in      the name of the first argument
+//      value1  in      the value of the first argument
+//      key2    in      the name of the second argument (or NULL)
+//      value2  in      the value of the second argument
+//
+void Trace::instant(const char  *name,
+                    const char  *cat,
+                    const char  *key1,
+                    const double value1,
+                    const char  *key2,
+                    const double value2)
+{
+    if (!enabled) return;
+    beginEvent(name, cat, "i", Profiler::now());
+    os << ", \"s\": \"t\", \"args\": {\"" << key1 << "\": " << value1;
+    if (key2 != NULL) os << ", \"" << key2 << "\": " << value2;
+    os << "}}";
+}   // instant(const char *, const char *, const char *, const double, ..)
+
+
+
+//
+// void counter(name, value)
+// Last modified: 19Oct2026
+//
+// Writes a counter event with the parameterized name and value,
+// at the current time.
+//
+// Returns:     <none>
+// Parameters:
+//      name    in      the name of the counter
+//      value   in      the value of the counter
+//
+void Trace::counter(const char *name, const double value)
+{
+    if (!enabled) return;
+    beginEvent(name, "count", "C", Profiler::now());
+    os << ", \"args\": {\"value\": " << value << "}}";
+}   // counter(const char *, const double)
+
+
+
+// <protected static utility functions>
+
+//
+// void beginEvent(name, cat, ph, t)
+// Last modified: 19Oct2026
+//
+// Writes the fields common to every event (leaving the event open).
+//
+// Returns:     <none>
+// Parameters:
+//      name    in      the name of the event
+//      cat     in      the category of the event
+//      ph      in      the phase (type) of the event
+//      t       in      the time of the event (from Profiler::now())
+//
+void Trace::beginEvent(const char  *name,
+                       const char  *cat,
+                       const char  *ph,
+                       const double t)
+{
+    os << (first ? "" : ",\n")
+       << "{\"name\": \"" << name << "\", \"cat\": \"" << cat
+       << "\", \"ph\": \"" << ph << "\", \"pid\": 1, \"tid\": 1, \"ts\": "
+       << toMicros(t);
+    first = false;
+}   // beginEvent(const char *, const char *, const char *, const double)
+
+
+
+//
+// double toMicros(t)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized time in microseconds since the trace began.
+//
+// Returns:     the time in microseconds since the trace began
+// Parameters:
+//      t       in      the time (from Profiler::now())
+//
+double Trace::toMicros(const double t)
+{
+    return (t - origin) * 1e6;
+}   // toMicros(const double)
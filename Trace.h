@@ -0,0 +1,57 @@
+//
+// Filename:        "Trace.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes the trace of the simulation, which
+//                  writes trace events (spans for the phases of each step,
+//                  instants for auction and formation events, and counters)
+//                  as trace-event JSON, loadable in a trace viewer
+//                  (chrome://tracing or Perfetto).  Every hook checks one
+//                  flag when tracing is disabled.
+//
+
+// preprocessor directives
+#ifndef TRACE_H
+#define TRACE_H
+#include <fstream>
+#include <string>
+using namespace std;
+
+
+
+// describes the (process-wide) trace-event writer
+class Trace
+{
+    public:
+
+        // <public static data members>
+        static bool enabled;
+
+        // <public static mutator functions>
+        static bool open(const string &filename);
+        static bool close();
+        static void span(const char *name, const double start,
+                         const double end);
+        static void instant(const char *name,
+                            const char *cat,
+                            const char *key1,
+                            const double value1,
+                            const char *key2   = NULL,
+                            const double value2 = 0.0);
+        static void counter(const char *name, const double value);
+
+    protected:
+
+        // <protected static data members>
+        static ofstream os;
+        static double   origin;     // the time of the first event
+        static bool     first;
+
+        // <protected static utility functions>
+        static void   beginEvent(const char *name, const char *cat,
+                                 const char *ph, const double t);
+        static double toMicros(const double t);
+};  // Trace
+
+#endif
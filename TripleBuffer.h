@@ -0,0 +1,64 @@
+//
+// Filename:        "TripleBuffer.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes a lock-free triple buffer, which
+//                  hands values (e.g., snapshots of the environment) from
+//                  one writer thread to one reader thread.  The writer
+//                  fills its back buffer and publishes it; the reader takes
+//                  the latest published buffer as its front buffer.
+//                  Neither waits for the other, the reader always has a
+//                  complete value, and the buffers are reused (a value
+//                  published while the reader is busy replaces the one
+//                  published before it).
+//
+
+// preprocessor directives
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+#include <atomic>
+
+
+
+// describes a triple buffer of values of the parameterized type
+template <class T>
+class TripleBuffer
+{
+    public:
+
+        // <constructors>
+        TripleBuffer(): middle(1), back(0), front(2) {}
+
+        // <public mutator functions> (of the writer)
+        T&   getBack()  { return buffers[back]; }
+        void publish()
+        {
+            back = middle.exchange(back | FRESH, std::memory_order_acq_rel) &
+                   INDEX;
+        }
+
+        // <public mutator functions> (of the reader)
+        bool update()
+        {
+            if ((middle.load(std::memory_order_relaxed) & FRESH) == 0)
+                return false;
+            front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+            return true;
+        }
+        T&   getFront() { return buffers[front]; }
+
+    protected:
+
+        // <protected static data members>
+        static const int INDEX = 3;    // the index bits of middle
+        static const int FRESH = 4;    // middle has been published
+
+        // <protected data members>
+        T                buffers[3];
+        std::atomic<int> middle;       // the last published (index | FRESH)
+        int              back;         // of the writer
+        int              front;        // of the reader
+};  // TripleBuffer
+
+#endif
@@ -12,7 +12,7 @@
 #define UTILS_H
 #include <cstdlib>
 #include <iostream>
-#include "GLIncludes.h"
+#include "GLTypes.h"
 using namespace std;
 
 
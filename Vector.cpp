@@ -8,6 +8,7 @@
 //
 
 // preprocessor directives
+#include "Renderer.h"
 #include "Vector.h"
 
 
@@ -138,9 +139,9 @@ bool Vector::set(const Vector &v)
 //
 bool Vector::setColor(const GLfloat r, const GLfloat g, const GLfloat b)
 {
-    color[GLUT_RED]   = r;
-    color[GLUT_GREEN] = g;
-    color[GLUT_BLUE]  = b;
+    color[RED_COMPONENT]   = r;
+    color[GREEN_COMPONENT] = g;
+    color[BLUE_COMPONENT]  = b;
     return true;
 }   // setColor(const GLfloat, const GLfloat, const GLfloat)
 
@@ -159,7 +160,7 @@ bool Vector::setColor(const GLfloat r, const GLfloat g, const GLfloat b)
 //
 bool Vector::setColor(const GLfloat clr[3])
 {
-    return setColor(clr[GLUT_RED], clr[GLUT_GREEN], clr[GLUT_BLUE]);
+    return setColor(clr[RED_COMPONENT], clr[GREEN_COMPONENT], clr[BLUE_COMPONENT]);
 }   // setColor(const GLfloat [])
 
 
@@ -447,52 +448,15 @@ bool Vector::normalize()
 // void draw()
 // Last modified: 07Nov2009
 //
-// Renders the vector as a line segment with a triangle head.
+// Renders the vector as a line segment with a triangle head
+// (by the current renderer, if any, see Renderer.h).
 //
 // Returns:     <none>
 // Parameters:  <none>
 //
 void Vector::draw()
 {
-    if ((color[GLUT_RED]   == COLOR[INVISIBLE][GLUT_RED])   &&
-        (color[GLUT_GREEN] == COLOR[INVISIBLE][GLUT_GREEN]) &&
-        (color[GLUT_BLUE]  == COLOR[INVISIBLE][GLUT_BLUE])) return;
-    glColor3fv(color);
-    glLineWidth(VECTOR_LINE_WIDTH);
-
-    glPushMatrix();
-        glRotated(rotate[0], 1, 0, 0);
-        glRotated(rotate[1], 0, 1, 0);
-        glRotated(rotate[2], 0, 0, 1);
-        glTranslated(translate[0], translate[1], translate[2]);
-        glRotated(angle(),   0, 0, 1);
-        glScaled(scale[0], scale[1], scale[2]);
-
-        // draw vector head
-        GLfloat mag = magnitude();
-        if ((showHead) && (mag >= VECTOR_HEAD_HEIGHT))
-        {
-            glColor3fv(color);
-            glBegin(GL_TRIANGLES);
-                glVertex3f(mag, 0.0f, 0.0f);
-                glVertex3f(mag - VECTOR_HEAD_HEIGHT,
-                           VECTOR_HEAD_WIDTH,
-                           0.0f);
-                glVertex3f(mag - VECTOR_HEAD_HEIGHT,
-                           -VECTOR_HEAD_WIDTH,
-                           0.0f);
-            glEnd();
-        }
-
-        // draw vector line
-        if (showLine)
-        {
-            glBegin(GL_LINES);
-                glVertex3f(0.0f,      0.0f, 0.0f);
-                glVertex3f(mag, 0.0f, 0.0f);
-            glEnd();
-        }
-    glPopMatrix();
+    if (Renderer::current != NULL) Renderer::current->drawVector(*this);
 }   // draw()
 
 
@@ -511,8 +475,11 @@ void Vector::draw()
 GLfloat Vector::angle() const
 {
     if ((x == 0.0f) && (y == 0.0f) && (z == 0.0f)) return 0.0f;
-    return sign(y) *
-           radiansToDegrees(acos(dotProduct(unit(*this), unit(Vector(1.0f)))));
+
+    // the dot product of the unit vector and the unit x-axis, without
+    // constructing either (angle() is called for every robot every step)
+    GLfloat cosTheta = x / magnitude();
+    return sign(y) * radiansToDegrees(acos(cosTheta));
 }   // angle()
 
 
@@ -0,0 +1,645 @@
+//
+// Filename:        "Assignment.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class implements an assignment of robots to
+//                  formation slots that minimizes the total (straight-line)
+//                  distance traveled.
+//
+
+// preprocessor directives
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Assignment.h"
+
+
+
+// <constructors>
+
+//
+// WorkerPool(nThreads)
+// Last modified: 19Oct2026
+//
+// Default constructor that starts (nThreads - 1) worker threads, the
+// calling thread always running the first chunk of work itself.
+//
+// Returns:     <none>
+// Parameters:
+//      nThreads    in      the total number of threads (default 1)
+//
+WorkerPool::WorkerPool(const int nThreads)
+    : task(NULL), taskN(0), nChunks(0), generation(0), pending(0),
+      sleepers(0), quit(false)
+{
+    for (int t = 1; t < max(1, nThreads); ++t)
+        workers.push_back(thread(&WorkerPool::work, this, t));
+}   // WorkerPool(const int)
+
+
+
+// <destructors>
+
+//
+// ~WorkerPool()
+// Last modified: 19Oct2026
+//
+// Destructor that stops and joins the worker threads.
+//
+// Returns:     <none>
+// Parameters:  <none>
+//
+WorkerPool::~WorkerPool()
+{
+    quit = true;
+    ++generation;
+    {
+        lock_guard<mutex> guard(lock);
+        wake.notify_all();
+    }
+    for (size_t t = 0; t < workers.size(); ++t) workers[t].join();
+}   // ~WorkerPool()
+
+
+
+// <public accessor functions>
+
+//
+// int getNThreads() const
+// Last modified: 19Oct2026
+//
+// Returns the total number of threads of this pool.
+//
+// Returns:     the total number of threads of this pool
+// Parameters:  <none>
+//
+int WorkerPool::getNThreads() const
+{
+    return (int)workers.size() + 1;
+}   // getNThreads() const
+
+
+
+// <public utility functions>
+
+//
+// int run(n, grain, fn)
+// Last modified: 19Oct2026
+//
+// Splits [0, n) into contiguous chunks of at least grain items (at most
+// one per thread), calls fn(begin, end, chunk) on each chunk in parallel,
+// and waits for all of them, returning the number of chunks; chunk t always
+// covers the t-th range, so per-chunk results reduce in index order.
+//
+// Returns:     the number of chunks
+// Parameters:
+//      n       in      the number of items
+//      grain   in      the minimum number of items per chunk
+//      fn      in      the function called on each chunk
+//
+int WorkerPool::run(const size_t n,
+                    const size_t grain,
+                    const function<void(size_t, size_t, int)> &fn)
+{
+    int k = (int)min((size_t)getNThreads(), max((size_t)1, n / max((size_t)1, grain)));
+    if (k <= 1)
+    {
+        fn(0, n, 0);
+        return 1;
+    }
+
+    task    = &fn;
+    taskN   = n;
+    nChunks = k;
+    pending = k - 1;
+    ++generation;
+    if (sleepers > 0)
+    {
+        lock_guard<mutex> guard(lock);
+        wake.notify_all();
+    }
+    fn(0, n / k, 0);
+    while (pending > 0) this_thread::yield();
+    return k;
+}   // run(const size_t, const size_t, const function<...> &)
+
+
+
+// <protected utility functions>
+
+//
+// void work(t)
+// Last modified: 19Oct2026
+//
+// Runs chunk t of each dispatched range of work, spinning briefly between
+// dispatches before sleeping until the next one.
+//
+// Returns:     <none>
+// Parameters:
+//      t       in      the index of this worker thread
+//
+void WorkerPool::work(const int t)
+{
+    unsigned int seen = 0;
+    for (;;)
+    {
+        for (int spin = 0; (generation == seen) && (spin < 4096); ++spin)
+            this_thread::yield();
+        if (generation == seen)
+        {
+            unique_lock<mutex> guard(lock);
+            ++sleepers;
+            wake.wait(guard, [&]() { return generation != seen; });
+            --sleepers;
+        }
+        seen = generation;
+        if (quit) return;
+        if (t < nChunks)
+        {
+            (*task)(taskN * t / nChunks, taskN * (t + 1) / nChunks, t);
+            --pending;
+        }
+    }
+}   // work(const int)
+
+
+
+// <constructors>
+
+//
+// Assignment(slotXY, robotXY, nThreads)
+// Last modified: 19Oct2026
+//
+// Constructor that initializes the problem from the parameterized
+// interleaved slot and robot positions.
+//
+// Returns:     <none>
+// Parameters:
+//      slotXY      in      the interleaved (x, y) slot positions
+//      robotXY     in      the interleaved (x, y) robot positions
+//      nThreads    in      the number of threads used to solve
+//
+Assignment::Assignment(const vector<float> &slotXY,
+                       const vector<float> &robotXY,
+                       const int            nThreads)
+    : method(ASSIGN_AUTO), errorBound(0.0), pool(nThreads)
+{
+    for (size_t i = 0; i + 1 < slotXY.size(); i += 2)
+    {
+        sx.push_back(slotXY[i]);
+        sy.push_back(slotXY[i + 1]);
+    }
+    for (size_t j = 0; j + 1 < robotXY.size(); j += 2)
+    {
+        rx.push_back(robotXY[j]);
+        ry.push_back(robotXY[j + 1]);
+    }
+}   // Assignment(const vector<float> &, const vector<float> &, const int)
+
+
+
+// <public mutator functions>
+
+//
+// bool solve(method, epsilon)
+// Last modified: 19Oct2026
+//
+// Attempts to assign a distinct robot to every slot, minimizing the total
+// distance, returning true if successful, false otherwise (e.g., fewer
+// robots than slots).  The automatic method uses the exact Hungarian method
+// for up to HUNGARIAN_MAX_SLOTS slots and the auction algorithm otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      method      in      the method used to solve (default ASSIGN_AUTO)
+//      epsilon     in      the final auction epsilon (0 for the default)
+//
+bool Assignment::solve(const AssignmentMethod method, const double epsilon)
+{
+    slotToRobot.clear();
+    errorBound = 0.0;
+    if ((sx.empty()) || (rx.size() < sx.size())) return false;
+
+    this->method = method;
+    if (this->method == ASSIGN_AUTO)
+        this->method = (sx.size() <= HUNGARIAN_MAX_SLOTS) ? ASSIGN_HUNGARIAN :
+                                                            ASSIGN_AUCTION;
+    return (this->method == ASSIGN_HUNGARIAN) ? solveHungarian() :
+                                                solveAuction(epsilon);
+}   // solve(const AssignmentMethod, const double)
+
+
+
+// <public accessor functions>
+
+//
+// AssignmentMethod getMethod() const
+// Last modified: 19Oct2026
+//
+// Returns the method used by the last solve.
+//
+// Returns:     the method used by the last solve
+// Parameters:  <none>
+//
+AssignmentMethod Assignment::getMethod() const
+{
+    return method;
+}   // getMethod() const
+
+
+
+//
+// size_t getNSlots() const
+// Last modified: 19Oct2026
+//
+// Returns the number of slots.
+//
+// Returns:     the number of slots
+// Parameters:  <none>
+//
+size_t Assignment::getNSlots() const
+{
+    return sx.size();
+}   // getNSlots() const
+
+
+
+//
+// size_t getNRobots() const
+// Last modified: 19Oct2026
+//
+// Returns the number of robots.
+//
+// Returns:     the number of robots
+// Parameters:  <none>
+//
+size_t Assignment::getNRobots() const
+{
+    return rx.size();
+}   // getNRobots() const
+
+
+
+//
+// const vector<int>& getAssignment() const
+// Last modified: 19Oct2026
+//
+// Returns the robot assigned to each slot by the last solve.
+//
+// Returns:     the robot assigned to each slot
+// Parameters:  <none>
+//
+const vector<int>& Assignment::getAssignment() const
+{
+    return slotToRobot;
+}   // getAssignment() const
+
+
+
+//
+// float getCost(slot, robot) const
+// Last modified: 19Oct2026
+//
+// Returns the distance between the parameterized slot and robot.
+//
+// Returns:     the distance between the slot and robot
+// Parameters:
+//      slot    in      the index of the slot
+//      robot   in      the index of the robot
+//
+float Assignment::getCost(const size_t slot, const size_t robot) const
+{
+    float dx = sx[slot] - rx[robot], dy = sy[slot] - ry[robot];
+    return sqrt(dx * dx + dy * dy);
+}   // getCost(const size_t, const size_t) const
+
+
+
+//
+// double getTotalDistance() const
+// Last modified: 19Oct2026
+//
+// Returns the total distance of the assignment found by the last solve.
+//
+// Returns:     the total distance of the assignment
+// Parameters:  <none>
+//
+double Assignment::getTotalDistance() const
+{
+    double total = 0.0;
+    for (size_t i = 0; i < slotToRobot.size(); ++i)
+        total += getCost(i, slotToRobot[i]);
+    return total;
+}   // getTotalDistance() const
+
+
+
+//
+// double getErrorBound() const
+// Last modified: 19Oct2026
+//
+// Returns the maximum amount by which the total distance of the last solve
+// may exceed the optimum (0 for the Hungarian method).
+//
+// Returns:     the maximum excess over the optimal total distance
+// Parameters:  <none>
+//
+double Assignment::getErrorBound() const
+{
+    return errorBound;
+}   // getErrorBound() const
+
+
+
+// <protected utility functions>
+
+//
+// bool solveHungarian()
+// Last modified: 19Oct2026
+//
+// Solves the assignment exactly with the O(n^2 m) Hungarian method (rows
+// are slots, columns are robots).  Each step's column scan is split across
+// the worker pool, each chunk first applying the previous step's potential
+// update to its own columns so that a step needs a single dispatch.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:  <none>
+//
+bool Assignment::solveHungarian()
+{
+    const size_t n = sx.size(), m = rx.size();
+    const double INF = numeric_limits<double>::infinity();
+    vector<double> u(n + 1, 0.0), v(m + 1, 0.0), minv(m + 1);
+    vector<size_t> p(m + 1, 0), way(m + 1, 0);
+    vector<char>   used(m + 1);
+    vector<double> bestDelta(pool.getNThreads());
+    vector<size_t> bestJ(pool.getNThreads());
+
+    for (size_t i = 1; i <= n; ++i)
+    {
+        size_t j0 = 0, i0;
+        double delta = 0.0;
+        p[0] = i;
+        fill(minv.begin(), minv.end(), INF);
+        fill(used.begin(), used.end(), 0);
+        do
+        {
+            i0 = p[j0];
+            int k = pool.run(m + 1, HUNGARIAN_MIN_COLUMNS,
+                             [&](size_t begin, size_t end, int t)
+            {
+                double best  = INF;
+                size_t bestC = 0;
+                for (size_t j = begin; j < end; ++j)
+                {
+                    if (used[j])
+                    {
+                        u[p[j]] += delta;
+                        v[j]    -= delta;
+                        continue;
+                    }
+                    minv[j] -= delta;
+                    if (j == j0)
+                    {
+                        used[j] = 1;
+                        continue;
+                    }
+                    double cur = getCost(i0 - 1, j - 1) - u[i0] - v[j];
+                    if (cur < minv[j])
+                    {
+                        minv[j] = cur;
+                        way[j]  = j0;
+                    }
+                    if (minv[j] < best)
+                    {
+                        best  = minv[j];
+                        bestC = j;
+                    }
+                }
+                bestDelta[t] = best;
+                bestJ[t]     = bestC;
+            });
+
+            // reduce in chunk order so ties resolve to the lowest column
+            delta = INF;
+            for (int t = 0; t < k; ++t)
+                if (bestDelta[t] < delta)
+                {
+                    delta = bestDelta[t];
+                    j0    = bestJ[t];
+                }
+            if (delta == INF) return false;
+        } while (p[j0] != 0);
+
+        // apply the final potential update
+        for (size_t j = 0; j <= m; ++j)
+            if (used[j])
+            {
+                u[p[j]] += delta;
+                v[j]    -= delta;
+            }
+            else minv[j] -= delta;
+
+        // augment along the alternating path
+        do
+        {
+            size_t j1 = way[j0];
+            p[j0] = p[j1];
+            j0    = j1;
+        } while (j0 != 0);
+    }
+
+    slotToRobot.assign(n, -1);
+    for (size_t j = 1; j <= m; ++j)
+        if (p[j] != 0) slotToRobot[p[j] - 1] = (int)(j - 1);
+    return true;
+}   // solveHungarian()
+
+
+
+//
+// bool solveAuction(epsilon)
+// Last modified: 19Oct2026
+//
+// Solves the assignment with the epsilon-scaling auction algorithm (slots
+// bid for robots).  Each round, every unassigned slot bids in parallel
+// (Jacobi) for its most profitable robot, and the highest bid for each
+// robot wins.  With more robots than slots, each phase ends with reverse
+// auction iterations (see reverseAuction()) so that the result stays
+// optimal for the asymmetric problem.  Epsilon is divided by AUCTION_EPSILON_SCALE each
+// phase down to the final epsilon, leaving the result within
+// (slots * epsilon) of the optimum.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      epsilon     in      the final epsilon (0 for the default)
+//
+bool Assignment::solveAuction(double epsilon)
+{
+    const size_t n   = sx.size(), m = rx.size();
+    const double INF = numeric_limits<double>::infinity();
+
+    // the largest possible cost bounds the initial epsilon
+    float maxSlot = 0.0f, maxRobot = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+        maxSlot  = max(maxSlot,  sqrt(sx[i] * sx[i] + sy[i] * sy[i]));
+    for (size_t j = 0; j < m; ++j)
+        maxRobot = max(maxRobot, sqrt(rx[j] * rx[j] + ry[j] * ry[j]));
+    double maxCost = max((double)(maxSlot + maxRobot), 1.0e-9);
+    if (epsilon <= 0.0) epsilon = AUCTION_EPSILON_FINAL * maxCost;
+
+    vector<double>       prices(m, 0.0), bidValue(n), bestBid(m);
+    vector<int>          owner(m), assigned(n), bidObject(n), bestBidder(m);
+    vector<unsigned int> bidRound(m, 0);
+    vector<int>          bidders, next;
+    unsigned int         round = 0;
+    double               eps   = max(maxCost / AUCTION_EPSILON_SCALE, epsilon);
+
+    for (;;)
+    {
+        fill(owner.begin(),    owner.end(),    -1);
+        fill(assigned.begin(), assigned.end(), -1);
+        bidders.clear();
+        for (size_t i = 0; i < n; ++i) bidders.push_back((int)i);
+
+        while (!bidders.empty())
+        {
+            ++round;
+
+            // each unassigned slot bids for its most profitable robot
+            pool.run(bidders.size(), max((size_t)1, ASSIGNMENT_MIN_WORK / m),
+                     [&](size_t begin, size_t end, int)
+            {
+                for (size_t k = begin; k < end; ++k)
+                {
+                    size_t i    = bidders[k];
+                    double best = -INF, second = -INF;
+                    int    bestJ = 0;
+                    for (size_t j = 0; j < m; ++j)
+                    {
+                        double value = -prices[j] - getCost(i, j);
+                        if (value > best)
+                        {
+                            second = best;
+                            best   = value;
+                            bestJ  = (int)j;
+                        }
+                        else if (value > second) second = value;
+                    }
+                    bidObject[k] = bestJ;
+                    bidValue[k]  = prices[bestJ] + eps +
+                                   ((second == -INF) ? 0.0 : best - second);
+                }
+            });
+
+            // the highest bid for each robot wins (ties go to the first)
+            for (size_t k = 0; k < bidders.size(); ++k)
+            {
+                int j = bidObject[k];
+                if ((bidRound[j] != round) || (bidValue[k] > bestBid[j]))
+                {
+                    bidRound[j]   = round;
+                    bestBid[j]    = bidValue[k];
+                    bestBidder[j] = bidders[k];
+                }
+            }
+            next.clear();
+            for (size_t k = 0; k < bidders.size(); ++k)
+            {
+                int j = bidObject[k];
+                if (bestBidder[j] != bidders[k])
+                {
+                    next.push_back(bidders[k]);
+                    continue;
+                }
+                if (owner[j] >= 0)
+                {
+                    assigned[owner[j]] = -1;
+                    next.push_back(owner[j]);
+                }
+                owner[j]           = bidders[k];
+                assigned[owner[j]] = j;
+                prices[j]          = bestBid[j];
+            }
+            bidders.swap(next);
+        }
+
+        if (m > n) reverseAuction(prices, owner, assigned, eps);
+
+        if (eps <= epsilon) break;
+        eps = max(eps / AUCTION_EPSILON_SCALE, epsilon);
+    }
+
+    slotToRobot = assigned;
+    errorBound  = (double)n * eps;
+    return true;
+}   // solveAuction(double)
+
+
+
+//
+// void reverseAuction(prices, owner, assigned, eps)
+// Last modified: 19Oct2026
+//
+// Runs the reverse auction iterations of the forward/reverse asymmetric
+// auction (Bertsekas and Castanon): each unassigned robot priced above the
+// cheapest assigned robot either takes the slot that values it most, at
+// the second-best value, or drops to that cheapest price.  Every slot must
+// already be assigned, and remains so.
+//
+// Returns:     <none>
+// Parameters:
+//      prices      in/out  the price of each robot
+//      owner       in/out  the slot assigned to each robot (or -1)
+//      assigned    in/out  the robot assigned to each slot
+//      eps         in      the epsilon of the current phase
+//
+void Assignment::reverseAuction(vector<double> &prices,
+                                vector<int>    &owner,
+                                vector<int>    &assigned,
+                                const double    eps)
+{
+    const size_t n   = sx.size(), m = rx.size();
+    const double INF = numeric_limits<double>::infinity();
+    double       lambda = INF;
+    vector<int>  lowered;
+
+    for (size_t i = 0; i < n; ++i)
+        lambda = min(lambda, prices[assigned[i]]);
+    for (size_t j = 0; j < m; ++j)
+        if ((owner[j] < 0) && (prices[j] > lambda)) lowered.push_back((int)j);
+    while (!lowered.empty())
+    {
+        int j = lowered.back();
+        lowered.pop_back();
+
+        double best = -INF, second = -INF;
+        int    bestI = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            double profit = -prices[assigned[i]] - getCost(i, assigned[i]);
+            double value  = -getCost(i, j) - profit;
+            if (value > best)
+            {
+                second = best;
+                best   = value;
+                bestI  = (int)i;
+            }
+            else if (value > second) second = value;
+        }
+        if (lambda >= best - eps)
+        {
+            prices[j] = lambda;
+            continue;
+        }
+
+        int previous = assigned[bestI];
+        prices[j]        = max(lambda, second - eps);
+        owner[previous]  = -1;
+        owner[j]         = bestI;
+        assigned[bestI]  = j;
+        if (prices[previous] > lambda) lowered.push_back(previous);
+    }
+}   // reverseAuction(vector<double> &, vector<int> &, vector<int> &,
+    //                const double)
@@ -0,0 +1,126 @@
+//
+// Filename:        "Assignment.h"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This class describes an assignment of robots to formation
+//                  slots that minimizes the total (straight-line) distance
+//                  traveled, solved exactly with the Hungarian method or
+//                  approximately with the epsilon-scaling auction algorithm.
+//
+
+// preprocessor directives
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+
+// assignment definitions
+#define HUNGARIAN_MAX_SLOTS     (2000)    // automatic method switches above
+#define HUNGARIAN_MIN_COLUMNS   (2048)    // columns per thread per step
+#define AUCTION_EPSILON_SCALE   (5.0)     // epsilon divisor between phases
+#define AUCTION_EPSILON_FINAL   (1.0e-6)  // default final epsilon (* max cost)
+#define ASSIGNMENT_MIN_WORK     (65536)   // cost evaluations per thread
+
+
+
+// assignment method index values
+enum AssignmentMethod
+{
+    ASSIGN_AUTO = 0,
+    ASSIGN_HUNGARIAN,
+    ASSIGN_AUCTION
+};  // AssignmentMethod
+
+
+
+// describes a fixed set of threads that run a range of work in
+// contiguous chunks, one chunk per thread, the caller running the first
+class WorkerPool
+{
+    public:
+
+        // <constructors>
+        WorkerPool(const int nThreads = 1);
+
+        // <destructors>
+        virtual ~WorkerPool();
+
+        // <public accessor functions>
+        int getNThreads() const;
+
+        // <public utility functions>
+        int run(const size_t n,
+                const size_t grain,
+                const function<void(size_t, size_t, int)> &fn);
+
+    protected:
+
+        // <protected data members>
+        vector<thread>                             workers;
+        const function<void(size_t, size_t, int)> *task;
+        size_t                                     taskN;
+        int                                        nChunks;
+        atomic<unsigned int>                       generation;
+        atomic<int>                                pending, sleepers;
+        atomic<bool>                               quit;
+        mutex                                      lock;
+        condition_variable                         wake;
+
+        // <protected utility functions>
+        void work(const int t);
+};  // WorkerPool
+
+
+
+// describes an optimal assignment of robots to formation slots
+class Assignment
+{
+    public:
+
+        // <constructors>
+        Assignment(const vector<float> &slotXY,
+                   const vector<float> &robotXY,
+                   const int            nThreads = 1);
+
+        // <public mutator functions>
+        bool solve(const AssignmentMethod method  = ASSIGN_AUTO,
+                   const double           epsilon = 0.0);
+
+        // <public accessor functions>
+        AssignmentMethod   getMethod()        const;
+        size_t             getNSlots()        const;
+        size_t             getNRobots()       const;
+        const vector<int>& getAssignment()    const;
+        float              getCost(const size_t slot,
+                                   const size_t robot) const;
+        double             getTotalDistance() const;
+        double             getErrorBound()    const;
+
+    protected:
+
+        // <protected data members>
+        vector<float>    sx, sy;        // slot positions
+        vector<float>    rx, ry;        // robot positions
+        vector<int>      slotToRobot;   // the robot assigned to each slot
+        AssignmentMethod method;        // the method used by the last solve
+        double           errorBound;    // the maximum excess over optimal
+        WorkerPool       pool;
+
+        // <protected utility functions>
+        bool solveHungarian();
+        bool solveAuction(double epsilon);
+        void reverseAuction(vector<double> &prices,
+                            vector<int>    &owner,
+                            vector<int>    &assigned,
+                            const double    eps);
+};  // Assignment
+
+#endif
@@ -1,4 +1,4 @@
 #!/bin/bash
 
-g++ solver.cpp -o solver
-./solver 10 keeptrying.txt random_xy_seeds_1.txt
+g++ -O2 -pthread solver.cpp Assignment.cpp ../SeedFile.cpp -o solver
+./solver -n 10 keeptrying.txt random_xy_seeds_1.txt
@@ -1,97 +1,248 @@
-#include <vector>
-#include <iostream>
+//
+// Filename:        "solver.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This program computes the optimal (minimum total
+//                  distance) assignment of the seed robots to the final
+//                  formation slots and compares it against the distance
+//                  the simulator reported in distances.out.
+//
+
+// preprocessor directives
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <sstream>
 #include <string>
-#include <stdio.h>
-#include <stdlib.h>
-#include <cmath>
-
+#include <thread>
+#include <vector>
+#include "Assignment.h"
+#include "../SeedFile.h"
 using namespace std;
 
-struct robot {
-    float x,y;
-    bool selected;
-};
 
-struct cell {
-    float x,y;
-    robot* r;
-};
 
-int main(int argc, char * argv[])
+// function prototypes
+void printUsage(char **argv);
+bool loadPositions(const string &filename, const int n, vector<float> &xy);
+bool loadSimulatorDistance(const string &filename, double &total, int &n);
+
+
+
+//
+// int main(argc, argv)
+// Last modified: 19Oct2026
+//
+// Loads the formation slots and robot seeds, solves the assignment, and
+// prints the comparison against the simulator.
+//
+// Returns:     0 if successful, 1 otherwise
+// Parameters:
+//      argc    in      an argument counter
+//      argv    in      initialization arguments
+//
+int main(int argc, char **argv)
 {
-    int num_bots;
-    string cell_pos,robot_pos;
-    if(argc==4)
+    AssignmentMethod method   = ASSIGN_AUTO;
+    int              nRobots  = -1;
+    int              nThreads = (int)max(1U, thread::hardware_concurrency());
+    double           epsilon  = 0.0;
+    string           outFile;
+    vector<string>   files;
+
+    for (int i = 1; i < argc; ++i)
     {
-        num_bots = atoi(argv[1]);
-        cell_pos = argv[2];
-        robot_pos = argv[3];
-        cout << "cell_pos = " << cell_pos << " and robot_pos = " << robot_pos << endl;
-    } else {
-        cout << "improper argument specification." << endl;
-        exit(1);
+        bool hasValue = i + 1 < argc;
+        if      ((!strcmp(argv[i], "-n")) && (hasValue)) nRobots  = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-j")) && (hasValue)) nThreads = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-e")) && (hasValue)) epsilon  = atof(argv[++i]);
+        else if ((!strcmp(argv[i], "-o")) && (hasValue)) outFile  = argv[++i];
+        else if ((!strcmp(argv[i], "-m")) && (hasValue))
+        {
+            ++i;
+            if      (!strcmp(argv[i], "hungarian")) method = ASSIGN_HUNGARIAN;
+            else if (!strcmp(argv[i], "auction"))   method = ASSIGN_AUCTION;
+            else if (!strcmp(argv[i], "auto"))      method = ASSIGN_AUTO;
+            else
+            {
+                printUsage(argv);
+                return 1;
+            }
+        }
+        else if (argv[i][0] != '-') files.push_back(argv[i]);
+        else
+        {
+            printUsage(argv);
+            return 1;
+        }
     }
-    ifstream robot_f,cell_f;
-    robot_f.open(robot_pos.c_str());
-
-    vector<robot> robots;
-
-    cout << "Robots: " << endl;
-    for(int i=0;i<num_bots;i++)
+    if ((files.size() < 2) || (files.size() > 3) || (nThreads < 1))
     {
-        float xx=0.0,yy=0.0;
-        robot_f >> xx;
-        robot_f >> yy;
-        robot r;
-        r.x = xx;
-        r.y = yy;
-        r.selected = false;
-        //cout << "x="<<xx<<" y="<<yy<<endl;
-        robots.push_back(r);
+        printUsage(argv);
+        return 1;
     }
-    robot_f.close();
 
-    for(int i=0;i<robots.size();i++)
+    vector<float> slotXY, robotXY;
+    if (!loadPositions(files[0], -1, slotXY))
+    {
+        cerr << ">> ERROR: Unable to load slots from '" << files[0] << "'.\n";
+        return 1;
+    }
+    if (nRobots < 0) nRobots = (int)(slotXY.size() / 2);
+    if (!loadPositions(files[1], nRobots, robotXY))
     {
-        cout <<" r.x="<< robots[i].x<<" r.y="<<robots[i].y<<endl;
+        cerr << ">> ERROR: Unable to load " << nRobots << " robots from '"
+             << files[1] << "'.\n";
+        return 1;
     }
 
-    cell_f.open(cell_pos.c_str());
-    vector<cell> cells;
-    cout << "Cells: " << endl;
-    for(int i=0;i<num_bots;i++)
+    Assignment assignment(slotXY, robotXY, nThreads);
+    if (!assignment.solve(method, epsilon))
     {
-        float xx=0.0,yx=0.0;
-        cell_f >> xx;
-        cell_f >> yx ;
-        cell c;
-        c.x = xx;
-        c.y = yx;
-        c.r = NULL;
-        cout << "x="<<xx<<" y="<<yx<<endl;
-        cells.push_back(c);
+        cerr << ">> ERROR: Unable to assign " << assignment.getNRobots()
+             << " robots to " << assignment.getNSlots() << " slots.\n";
+        return 1;
     }
-    cell_f.close();
 
-    bool answerFound = false;
-    while(!answerFound)
+    size_t n       = assignment.getNSlots();
+    double optimal = assignment.getTotalDistance();
+    cout << "slots = "   << n << ", robots = " << assignment.getNRobots()
+         << ", threads = " << nThreads << ", method = "
+         << ((assignment.getMethod() == ASSIGN_HUNGARIAN) ? "hungarian" :
+                                                            "auction")
+         << endl;
+    cout << "Optimal Total Distance = " << optimal;
+    if (assignment.getErrorBound() > 0.0)
+        cout << " (within " << assignment.getErrorBound() << ")";
+    cout << endl;
+    cout << "Optimal Average Distance = " << optimal / n << endl;
+
+    if (files.size() == 3)
     {
-        for(int c=0;c<cells.size();c++)
+        double simulated = 0.0;
+        int    nCells    = 0;
+        if (!loadSimulatorDistance(files[2], simulated, nCells))
         {
-            float distance = 9999999.9;
+            cerr << ">> ERROR: Unable to load '" << files[2] << "'.\n";
+            return 1;
         }
-    }            
+        if ((size_t)nCells != n)
+            cerr << ">> WARNING: " << files[2] << " has " << nCells
+                 << " cells but there are " << n << " slots.\n";
+        cout << "Simulator Total Distance = " << simulated << endl;
+        cout << "Simulator Average Distance = "
+             << simulated / max(nCells, 1) << endl;
+        cout << "Excess Distance = " << simulated - optimal << endl;
+        if (optimal > 0.0)
+            cout << "Simulator / Optimal = " << simulated / optimal << endl;
+    }
 
+    if (!outFile.empty())
+    {
+        ofstream os(outFile.c_str());
+        const vector<int> &a = assignment.getAssignment();
+        for (size_t i = 0; i < a.size(); ++i)
+            os << i << ", " << a[i] << ", " << assignment.getCost(i, a[i])
+               << endl;
+    }
     return 0;
-}
+}   // main(int, char **)
 
-float distance(float x,  float y, float xx, float yy)
+
+
+//
+// void printUsage(argv)
+// Last modified: 19Oct2026
+//
+// Prints the program usage message.
+//
+// Returns:     <none>
+// Parameters:
+//      argv    in      initialization arguments
+//
+void printUsage(char **argv)
 {
-    float answer = 99999999.9;
-    float xxx = x-xx;
-    float yyy = y-yy;
-    answer = sqrt((xxx*xxx)+(yyy*yyy));
-    return answer;
-}
+    fprintf(stderr,
+            "USAGE: %s [-m hungarian|auction|auto] [-n <nRobots>]"
+            " [-j <nThreads>] [-e <epsilon>] [-o <assignmentFile>]"
+            " <slotFile> <seedFile> [distancesFile]\n"
+            "      -m: the assignment method (default=auto, which uses"
+            " hungarian for up to %d slots)\n"
+            "      -n <nRobots>: the number of seed robots (default=slots)\n"
+            "      -j <nThreads>: the number of threads"
+            " (default=all cores)\n"
+            "      -e <epsilon>: the final auction epsilon (default=%g *"
+            " max distance)\n"
+            "      -o <assignmentFile>: writes \"slot, robot, distance\""
+            " lines\n"
+            "      slotFile: final cell positions (e.g., positions.out)\n"
+            "      seedFile: initial robot positions (any seed format)\n"
+            "      distancesFile: the simulator's distances.out\n",
+            argv[0], HUNGARIAN_MAX_SLOTS, AUCTION_EPSILON_FINAL);
+}   // printUsage(char **)
+
+
 
+//
+// bool loadPositions(filename, n, xy)
+// Last modified: 19Oct2026
+//
+// Loads the first n positions (all if n is negative) of the parameterized
+// position file, returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the position file
+//      n           in      the number of positions (all if negative)
+//      xy          out     the interleaved (x, y) positions
+//
+bool loadPositions(const string &filename, const int n, vector<float> &xy)
+{
+    SeedFile file;
+    if (!file.open(filename)) return false;
+    unsigned int count = (n < 0) ? file.getNPositions() : (unsigned int)n;
+    if (count > file.getNPositions()) return false;
+    xy.assign(file.getPositions(), file.getPositions() + 2 * count);
+    return true;
+}   // loadPositions(const string &, const int, vector<float> &)
+
+
+
+//
+// bool loadSimulatorDistance(filename, total, n)
+// Last modified: 19Oct2026
+//
+// Loads the total distance traveled by the cells from the final step of
+// the parameterized distances file ("step, d0, d1, ..." rows), returning
+// true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      filename    in      the name of the distances file
+//      total       out     the total distance traveled by the cells
+//      n           out     the number of cells
+//
+bool loadSimulatorDistance(const string &filename, double &total, int &n)
+{
+    ifstream is(filename.c_str());
+    string   line, last;
+    while (getline(is, line))
+        if (line.find_first_not_of(" \t\r") != string::npos) last = line;
+    if (last.empty()) return false;
+
+    stringstream ss(last);
+    string       value;
+    total = 0.0;
+    n     = 0;
+    getline(ss, value, ',');                 // skip the step number
+    while (getline(ss, value, ','))
+    {
+        if (value.find_first_not_of(" \t\r") == string::npos) continue;
+        total += atof(value.c_str());
+        ++n;
+    }
+    return true;
+}   // loadSimulatorDistance(const string &, double &, int &)
@@ -0,0 +1,230 @@
+#!/usr/bin/perl
+#
+# Filename:        "golden.pl"
+#
+# Last modified:   19Oct2026
+#
+# Description:     This script checks that the simulation still produces
+#                  the same results.  Every (policy, robots, formation) run
+#                  of a small matrix is headless and deterministic (a fixed
+#                  seed file and random seed), and its summary (steps,
+#                  messages, converged cells), a digest of its full
+#                  trajectory, and a sample of its trajectory (every few
+#                  steps, and the last step) are compared against the
+#                  golden output stored in support/golden/.  By default the
+#                  trajectory must match bit for bit (by its digest); with
+#                  a tolerance, every sampled position and heading must be
+#                  within the tolerance instead (the summary must still
+#                  match).  With --record, the golden output is rewritten.
+#                  Every policy and formation is also run with discrete
+#                  message passing (-D) on the larger --discrete-n robots;
+#                  those runs must also quiesce within their step limit.
+#
+# Usage:           golden.pl [--sim <Simulator>] [--record]
+#                            [--tolerance <tolerance>] [--golden <dir>]
+#                            [--n <n1,n2,..>] [--policies <p1,..>]
+#                            [--formations <f1,..>] [--seed <seed>]
+#                            [--max-steps <steps>] [--every <steps>]
+#                            [--discrete-n <n1,..>]
+#                            [--discrete-max-steps <steps>]
+#
+use strict;
+use warnings;
+use Cwd qw(abs_path);
+use Digest::MD5;
+use File::Basename qw(dirname);
+use File::Temp qw(tempdir);
+use Getopt::Long;
+
+
+my $base       = abs_path(dirname(abs_path($0)) . "/..");
+my $simulator  = $base . "/Simulator";
+my $golden_dir = $base . "/support/golden";
+my $seed_file  = $base . "/support/seeds/random_xy_seeds_1.txt";
+my $record     = 0;
+my $tolerance  = 0.0;                   # 0 = bit-exact
+my $nums       = "10,20";
+my $policies   = "push,insertion";
+my $formations = "0,6";
+my $seed       = 1;                     # seed of rand() (-S)
+my $max_steps  = 1000;
+my $every      = 25;                    # steps between trajectory samples
+my $discrete_nums      = "50";          # robots of the discrete (-D) runs
+my $discrete_max_steps = 6000;
+
+GetOptions("sim=s"        => \$simulator,
+           "record"       => \$record,
+           "tolerance=f"  => \$tolerance,
+           "golden=s"     => \$golden_dir,
+           "n=s"          => \$nums,
+           "policies=s"   => \$policies,
+           "formations=s" => \$formations,
+           "seed=i"       => \$seed,
+           "max-steps=i"  => \$max_steps,
+           "every=i"      => \$every,
+           "discrete-n=s"         => \$discrete_nums,
+           "discrete-max-steps=i" => \$discrete_max_steps) or die "usage: $0 [--sim s] [--record] [--tolerance t] [--golden d] [--n n1,..] [--policies p1,..] [--formations f1,..] [--seed s] [--max-steps m] [--every e] [--discrete-n n1,..] [--discrete-max-steps m]\n";
+$simulator = abs_path($simulator);
+die "simulator '$simulator' not found (make first)\n" unless -x $simulator;
+die "every must be positive\n"                        unless $every > 0;
+mkdir($golden_dir) if $record && !-d $golden_dir;
+
+# the runs: (name, policy, robots, formation, discrete)
+my @runs;
+for my $policy (split(/,/, $policies)){
+    for my $num_robots (split(/,/, $nums)){
+        push(@runs, ["${policy}_${num_robots}_$_", $policy, $num_robots, $_, 0])
+            for split(/,/, $formations);
+    }
+    for my $num_robots (split(/,/, $discrete_nums)){
+        push(@runs, ["${policy}_${num_robots}_${_}_discrete", $policy,
+                     $num_robots, $_, 1]) for split(/,/, $formations);
+    }
+}
+
+my ($n_failures, $n_runs) = (0, 0);
+for my $r (@runs){
+    my ($name, $policy, $num_robots, $f, $discrete) = @$r;
+    my $file = "$golden_dir/$name.golden";
+    my $run  = run_sim($policy, $num_robots, $f, $discrete);
+    $n_runs++;
+    if ($record){
+        die "$name did not quiesce within $run->{max_steps} steps\n"
+            if $discrete && !$run->{quiesced};
+        write_golden($file, $run);
+        printf "%-24s recorded (%d steps)\n", $name, $run->{steps};
+        next;
+    }
+    my $golden = read_golden($file);
+    my @errors = defined($golden) ? compare($golden, $run)
+                                  : ("no golden output ($file)");
+    unshift(@errors, "did not quiesce within $run->{max_steps} steps")
+        if $discrete && !$run->{quiesced};
+    printf "%-24s %s\n", $name, @errors ? "FAIL" : "ok";
+    print "    $_\n" for @errors;
+    $n_failures++ if @errors;
+}
+if ((!$record) && ($n_failures > 0)){
+    printf "%d of %d run(s) differ from the golden output in %s\n",
+           $n_failures, $n_runs, $golden_dir;
+    exit(1);
+}
+exit(0);
+
+
+# runs one headless, deterministic simulation in a scratch directory,
+# returning its command, summary, trajectory digest, and sampled trajectory
+sub run_sim {
+    my ($policy, $num_robots, $f, $discrete) = @_;
+    my $dir   = tempdir(CLEANUP => 1);
+    my $limit = $discrete ? $discrete_max_steps : $max_steps;
+    my $args  = "-g -a $policy -n $num_robots -f $f -S $seed -m $limit" .
+                ($discrete ? " -D" : "");
+    my $sim_call = "cd $dir && $simulator $args -s $seed_file" .
+                   " -o trajectory.csv > stdout.out 2>&1";
+    print STDERR "running $policy with $num_robots robots on formation $f" .
+                 ($discrete ? " (discrete)\n" : "\n");
+    system($sim_call) == 0 or die "sim did not exit properly: $sim_call\n";
+
+    my %run = (args => $args, steps => -1, messages => -1, converged => -1,
+               max_steps => $limit);
+    open(my $fh, "<", "$dir/stdout.out") or die "no output from: $sim_call\n";
+    while(<$fh>){
+        $run{steps}     = $1 if /total steps = (\d+)/;
+        $run{messages}  = $1 if /Total Messages sent :\s+(\d+)/;
+        $run{converged} = $1 if /Total Converged Cells:\s+(\d+)/;
+    }
+    close($fh);
+    $run{quiesced} = ($run{steps} >= 0) && ($run{steps} < $limit) &&
+                     ($run{converged} == $num_robots);
+
+    # digest every line, keeping those of the sampled (and the last) steps
+    my $md5 = Digest::MD5->new();
+    my (@sample, @last);
+    my $last_step = -1;
+    open($fh, "<", "$dir/trajectory.csv") or die "no trajectory from: $sim_call\n";
+    while(my $line = <$fh>){
+        $md5->add($line);
+        my ($step) = split(/,/, $line, 2);
+        ($last_step, @last) = ($step) if $step != $last_step;
+        if ($step % $every == 0){ push(@sample, $line); }
+        else                    { push(@last,   $line); }
+    }
+    push(@sample, @last);
+    close($fh);
+    $run{digest} = $md5->hexdigest();
+    chomp(@sample);
+    $run{trajectory} = \@sample;
+    return \%run;
+}
+
+
+# writes the golden output of a run
+sub write_golden {
+    my ($file, $run) = @_;
+    open(my $fh, ">", $file) or die "unable to open '$file': $!\n";
+    print $fh "# Simulator $run->{args} -s support/seeds/random_xy_seeds_1.txt\n";
+    print $fh "steps $run->{steps}\n";
+    print $fh "messages $run->{messages}\n";
+    print $fh "converged $run->{converged}\n";
+    print $fh "digest $run->{digest}\n";
+    print $fh "trajectory (step,kind,id,x,y,heading every $every steps)\n";
+    print $fh "$_\n" for @{$run->{trajectory}};
+    close($fh);
+}
+
+
+# reads the golden output of a run (undef if there is none)
+sub read_golden {
+    my ($file) = @_;
+    open(my $fh, "<", $file) or return undef;
+    my %golden = (trajectory => []);
+    my $in_trajectory = 0;
+    while(<$fh>){
+        chomp;
+        next if /^#/;
+        if    ($in_trajectory)        { push(@{$golden{trajectory}}, $_); }
+        elsif (/^trajectory/)         { $in_trajectory = 1; }
+        elsif (/^(\w+)\s+(\S+)$/)     { $golden{$1} = $2; }
+    }
+    close($fh);
+    return \%golden;
+}
+
+
+# compares a run against its golden output, returning the differences
+sub compare {
+    my ($golden, $run) = @_;
+    my @errors;
+    for my $key ("steps", "messages", "converged"){
+        push(@errors, "$key: $run->{$key} (expected $golden->{$key})")
+            if $run->{$key} != $golden->{$key};
+    }
+    if ($tolerance <= 0.0){
+        push(@errors, "trajectory digest: $run->{digest} (expected $golden->{digest})")
+            if $run->{digest} ne $golden->{digest};
+        return @errors;
+    }
+
+    my ($expected, $actual) = ($golden->{trajectory}, $run->{trajectory});
+    push(@errors, sprintf("trajectory: %d sampled lines (expected %d)",
+                          scalar(@$actual), scalar(@$expected)))
+        if @$actual != @$expected;
+    my $max_error = 0.0;
+    for (my $i = 0; ($i < @$expected) && ($i < @$actual); ++$i){
+        my @e = split(/,/, $expected->[$i]);
+        my @a = split(/,/, $actual->[$i]);
+        if (($e[0] != $a[0]) || ($e[1] ne $a[1]) || ($e[2] != $a[2])){
+            push(@errors, "trajectory: '$actual->[$i]' (expected '$expected->[$i]')");
+            last;
+        }
+        for my $j (3 .. 5){
+            my $error = abs($e[$j] - $a[$j]);
+            $error = 360.0 - $error if ($j == 5) && ($error > 180.0);
+            $max_error = $error if $error > $max_error;
+        }
+    }
+    push(@errors, sprintf("trajectory: error %g (tolerance %g)", $max_error, $tolerance))
+        if $max_error > $tolerance;
+    return @errors;
+}
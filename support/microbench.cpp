@@ -0,0 +1,519 @@
+//
+// Filename:        "microbench.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This program benchmarks the primitives of the simulation
+//                  (vector arithmetic, formation relationships, neighborhood
+//                  lookups, mailbox coalescing, packet forwarding, cell
+//                  state updates, and robot behaviors), reporting the time
+//                  (ns/op) and heap allocations (allocs/op) of each as CSV
+//                  (or as JSON, if the output file name ends in ".json").
+//                  The mailbox benchmarks fail if more than a state per
+//                  sender is queued.  The benchmarks that need a formation
+//                  use an environment that has formed (by insertion
+//                  auctions) from a seed file.
+//
+
+// preprocessor directives
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unistd.h>
+#include "../AuctionPolicy.h"
+#include "../Formations.h"
+using namespace std;
+
+
+
+// global constants
+static const double  DEFAULT_MIN_SECONDS = 0.2;    // per benchmark
+static const GLint   DEFAULT_N_ROBOTS    = 20;
+static const char    DEFAULT_SEED_FILE[] = "support/seeds/random_xy_seeds_1.txt";
+static const GLint   MAX_SETUP_STEPS     = 10000;
+
+
+
+// global variables
+static long           g_nAllocs = 0;       // heap allocations (operator new)
+static volatile float g_sink    = 0.0f;    // keeps results from being elided
+static Environment   *g_env     = NULL;
+
+
+
+// <allocation counting>
+
+void* operator new(size_t size)
+{
+    ++g_nAllocs;
+    void *p = malloc((size == 0) ? 1 : size);
+    if (p == NULL) throw bad_alloc();
+    return p;
+}   // operator new(size_t)
+
+void* operator new[](size_t size)
+{
+    ++g_nAllocs;
+    void *p = malloc((size == 0) ? 1 : size);
+    if (p == NULL) throw bad_alloc();
+    return p;
+}   // operator new[](size_t)
+
+void operator delete(void *p) throw()
+{
+    free(p);
+}   // operator delete(void *)
+
+void operator delete[](void *p) throw()
+{
+    free(p);
+}   // operator delete[](void *)
+
+void operator delete(void *p, size_t) throw()
+{
+    free(p);
+}   // operator delete(void *, size_t)
+
+void operator delete[](void *p, size_t) throw()
+{
+    free(p);
+}   // operator delete[](void *, size_t)
+
+
+
+// <benchmarks>
+
+// each benchmark runs its operation the parameterized number of times
+// (with the parameterized argument, e.g., a formation index)
+typedef void (*BenchmarkFunction)(const long nOps, const int arg);
+
+static void benchVectorAdd(const long nOps, const int)
+{
+    Vector a(0.1f, 0.2f), b(0.3f, 0.4f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        a.x = (GLfloat)(i & 1023) * 1e-3f;
+        Vector c = a + b;
+        g_sink += c.x;
+    }
+}   // benchVectorAdd(const long, const int)
+
+static void benchVectorScale(const long nOps, const int)
+{
+    Vector a(0.1f, 0.2f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        a.x = (GLfloat)(i & 1023) * 1e-3f;
+        Vector c = 0.5f * a;
+        g_sink += c.x;
+    }
+}   // benchVectorScale(const long, const int)
+
+static void benchVectorMagnitude(const long nOps, const int)
+{
+    Vector a(0.1f, 0.2f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        a.x = (GLfloat)(i & 1023) * 1e-3f;
+        g_sink += a.magnitude();
+    }
+}   // benchVectorMagnitude(const long, const int)
+
+static void benchVectorAngle(const long nOps, const int)
+{
+    Vector a(0.1f, 0.2f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        a.x = (GLfloat)(i & 1023) * 1e-3f - 0.5f;
+        g_sink += a.angle();
+    }
+}   // benchVectorAngle(const long, const int)
+
+static void benchFormationRelationship(const long nOps, const int index)
+{
+    GLfloat   r = DEFAULT_ROBOT_RADIUS * FACTOR_COLLISION_RADIUS;
+    Formation f(formations[index], r, Vector(), 0, 0, 90.0f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        Vector c((GLfloat)(i & 63) * r, 0.0f);
+        g_sink += f.getRelationship(formations[index], r, c, 90.0f).x;
+    }
+}   // benchFormationRelationship(const long, const int)
+
+static void initNeighborhood(Neighborhood &nh, const int nNbrs)
+{
+    for (int i = 0; i < nNbrs; ++i)
+    {
+        State s;
+        s.gradient = Vector((GLfloat)((i * 7) % nNbrs), (GLfloat)i);
+        nh.addNbr(i, s);
+    }
+}   // initNeighborhood(Neighborhood &, const int)
+
+static void benchNbrWithID(const long nOps, const int nNbrs)
+{
+    Neighborhood nh;
+    initNeighborhood(nh, nNbrs);
+    for (long i = 0; i < nOps; ++i)
+        g_sink += (GLfloat)nh.nbrWithID((GLint)(i % nNbrs))->ID;
+}   // benchNbrWithID(const long, const int)
+
+static void benchNbrWithMinGradient(const long nOps, const int nNbrs)
+{
+    Neighborhood nh;
+    initNeighborhood(nh, nNbrs);
+    for (long i = 0; i < nOps; ++i)
+    {
+        Vector c((GLfloat)(i & 7), 0.0f);
+        g_sink += (GLfloat)nh.nbrWithMinGradient(c)->ID;
+    }
+}   // benchNbrWithMinGradient(const long, const int)
+
+static void benchForwardPacket(const long nOps, const int)
+{
+    GLint nCells = g_env->getNCells();
+    for (long i = 0; i < nOps; ++i)
+    {
+        GLint to = (GLint)(i % nCells);
+        g_env->forwardPacket(Packet(NULL, to, (to + 1) % nCells, HEARTBEAT));
+        g_env->getCell(to)->msgQueue.pop();
+    }
+}   // benchForwardPacket(const long, const int)
+
+static bool supersedesAny(const Packet &, const Packet &)
+{
+    return true;
+}   // supersedesAny(const Packet &, const Packet &)
+
+static void benchMailboxCoalesce(const long nOps, const int nSenders)
+{
+    Mailbox<Packet, MAILBOX_CAPACITY> m;
+    Packet                            old;
+    for (long i = 0; i < nOps; ++i)
+    {
+        Packet p(NULL, 0, (GLint)(i % nSenders), STATE);
+        if (!m.replace(p, p.fromID, supersedesAny, old)) m.push(p, p.fromID);
+        g_sink += (GLfloat)m.size();
+    }
+    if (m.size() > nSenders)    // a state is queued per sender at most
+    {
+        fprintf(stderr, ">> ERROR: %d senders left %d packets queued...\n",
+                nSenders, m.size());
+        exit(1);
+    }
+}   // benchMailboxCoalesce(const long, const int)
+
+static void benchUpdateState(const long nOps, const int)
+{
+    Cell *c = g_env->getCell(g_env->getNCells() / 2);
+    for (long i = 0; i < nOps; ++i)
+    {
+        c->updateState();
+        g_sink += c->getState().transError.x;
+    }
+}   // benchUpdateState(const long, const int)
+
+static void benchMoveArcBehavior(const long nOps, const int)
+{
+    Robot r(0.0f, 0.0f, 0.0f, 90.0f);
+    for (long i = 0; i < nOps; ++i)
+    {
+        Vector target((GLfloat)(i & 255) * 0.01f - 1.28f, 0.5f);
+        g_sink += r.moveArcBehavior(target).getTransVel();
+    }
+}   // benchMoveArcBehavior(const long, const int)
+
+
+
+// describes a benchmark (by name) and its argument
+struct Benchmark
+{
+    string            name;
+    BenchmarkFunction function;
+    int               arg;
+    bool              needsEnv;
+};  // Benchmark
+
+// describes the measurement of a benchmark
+struct Measurement
+{
+    string name;
+    long   nOps;
+    double nsPerOp;
+    double allocsPerOp;
+};  // Measurement
+
+
+
+// <utility functions>
+
+//
+// vector<Benchmark> getBenchmarks()
+// Last modified: 19Oct2026
+//
+// Returns every benchmark (a formation relationship benchmark
+// for each of the formation-testing functions).
+//
+// Returns:     the benchmarks
+// Parameters:  <none>
+//
+static vector<Benchmark> getBenchmarks()
+{
+    vector<Benchmark> b;
+    Benchmark vec[] =
+    {
+        {"vector_add",       benchVectorAdd,       0, false},
+        {"vector_scale",     benchVectorScale,     0, false},
+        {"vector_magnitude", benchVectorMagnitude, 0, false},
+        {"vector_angle",     benchVectorAngle,     0, false}
+    };
+    b.insert(b.end(), vec, vec + 4);
+    for (int i = 0; i < N_FORMATIONS; ++i)
+    {
+        char name[64];
+        sprintf(name, "formation_getRelationship/%d", i);
+        Benchmark f = {name, benchFormationRelationship, i, false};
+        b.push_back(f);
+    }
+    int nNbrs[] = {2, 4, MAX_NEIGHBORHOOD_SIZE};
+    for (int i = 0; i < 3; ++i)
+    {
+        char name[64];
+        sprintf(name, "neighborhood_nbrWithID/%d", nNbrs[i]);
+        Benchmark id = {name, benchNbrWithID, nNbrs[i], false};
+        sprintf(name, "neighborhood_nbrWithMinGradient/%d", nNbrs[i]);
+        Benchmark grad = {name, benchNbrWithMinGradient, nNbrs[i], false};
+        b.push_back(id);
+        b.push_back(grad);
+    }
+    int nSenders[] = {2, 6, 2 * MAX_NEIGHBORHOOD_SIZE + 1};
+    for (int i = 0; i < 3; ++i)
+    {
+        char name[64];
+        sprintf(name, "mailbox_coalesce/%d", nSenders[i]);
+        Benchmark m = {name, benchMailboxCoalesce, nSenders[i], false};
+        b.push_back(m);
+    }
+    Benchmark env[] =
+    {
+        {"environment_forwardPacket", benchForwardPacket,   0, true},
+        {"cell_updateState",          benchUpdateState,     0, true},
+        {"robot_moveArcBehavior",     benchMoveArcBehavior, 0, false}
+    };
+    b.insert(b.end(), env, env + 3);
+    return b;
+}   // getBenchmarks()
+
+
+
+//
+// Measurement measure(b, minSeconds)
+// Last modified: 19Oct2026
+//
+// Runs the parameterized benchmark with a growing number of operations
+// until a run takes at least the parameterized time, returning the
+// time and allocations per operation of that run.
+//
+// Returns:     the measurement of the benchmark
+// Parameters:
+//      b           in      the benchmark being measured
+//      minSeconds  in      the least time of the measured run
+//
+static Measurement measure(const Benchmark &b, const double minSeconds)
+{
+    Measurement m;
+    m.name = b.name;
+    b.function(1, b.arg);                   // warm up
+    for (long nOps = 1; ; )
+    {
+        long   allocs = g_nAllocs;
+        double start  = Profiler::now();
+        b.function(nOps, b.arg);
+        double seconds = Profiler::now() - start;
+        allocs = g_nAllocs - allocs;
+        if ((seconds >= minSeconds) || (nOps >= (1L << 40)))
+        {
+            m.nOps        = nOps;
+            m.nsPerOp     = seconds * 1e9 / nOps;
+            m.allocsPerOp = (double)allocs / nOps;
+            return m;
+        }
+        nOps *= (seconds < 0.1 * minSeconds) ? 10 : 2;
+    }
+}   // measure(const Benchmark &, const double)
+
+
+
+//
+// bool initEnv(nRobots, seedFile)
+// Last modified: 19Oct2026
+//
+// Attempts to form a line from the parameterized number of robots (at
+// the positions in the parameterized seed file) by insertion auctions,
+// with the output of the simulation suppressed, returning true if
+// successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      nRobots     in      the number of robots
+//      seedFile    in      the seed file of the robot positions
+//
+static bool initEnv(const GLint nRobots, const string &seedFile)
+{
+    fflush(stdout);
+    int out = dup(STDOUT_FILENO), null = open("/dev/null", O_WRONLY);
+    if ((out >= 0) && (null >= 0)) dup2(null, STDOUT_FILENO);
+
+    Formation f(formations[0], DEFAULT_ROBOT_RADIUS * FACTOR_COLLISION_RADIUS,
+                Vector(), 0, 0, 90.0f);
+    g_env = new Environment(nRobots, f, DEFAULT_ENV_COLOR, 1,
+                            MAX_TRANSLATIONAL_ERROR, seedFile, "insertion");
+    g_env->formFromClick(0.0001f, 0.0001f);
+    for (GLint i = 0; (i < MAX_SETUP_STEPS) && (g_env->step()); ++i);
+
+    cout.flush();
+    fflush(stdout);
+    if (out >= 0) dup2(out, STDOUT_FILENO);
+    if (out >= 0)  close(out);
+    if (null >= 0) close(null);
+    return g_env->getNCells() > 1;
+}   // initEnv(const GLint, const string &)
+
+
+
+//
+// bool writeResults(out, results, json)
+// Last modified: 19Oct2026
+//
+// Writes the parameterized measurements to the parameterized stream
+// (as JSON, or as CSV), returning true if successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      out         in/out  the stream written to
+//      results     in      the measurements
+//      json        in      true to write JSON, false to write CSV
+//
+static bool writeResults(ostream                   &out,
+                         const vector<Measurement> &results,
+                         const bool                 json)
+{
+    out.setf(ios::fixed);
+    out.precision(3);
+    if (json) out << "{\"benchmarks\": [" << endl;
+    else      out << "name,ns_per_op,allocs_per_op,ops" << endl;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Measurement &m = results[i];
+        if (json)
+            out << "  {\"name\": \"" << m.name << "\", \"ns_per_op\": "
+                << m.nsPerOp << ", \"allocs_per_op\": " << m.allocsPerOp
+                << ", \"ops\": " << m.nOps << "}"
+                << ((i + 1 < results.size()) ? "," : "") << endl;
+        else
+            out << m.name << "," << m.nsPerOp << "," << m.allocsPerOp << ","
+                << m.nOps << endl;
+    }
+    if (json) out << "]}" << endl;
+    return out.good();
+}   // writeResults(ostream &, const vector<Measurement> &, const bool)
+
+
+
+//
+// void printUsage(program)
+// Last modified: 19Oct2026
+//
+// Displays the usage of the program.
+//
+// Returns:     <none>
+// Parameters:
+//      program in      the name of the program
+//
+static void printUsage(const char *program)
+{
+    fprintf(stderr,
+            "USAGE: %s [-o <file>] [-f <filter>] [-m <ms>] [-n <nRobots>]"
+            " [-s <seedFile>]\n"
+            "      -o <file>: write the results to <file>"
+            " (.json for JSON, CSV otherwise; default=stdout as CSV)\n"
+            "      -f <filter>: run only the benchmarks whose names"
+            " contain <filter>\n"
+            "      -m <ms>: least time of a measured run (default=%g)\n"
+            "      -n <nRobots>: robots in the formed environment"
+            " (default=%d)\n"
+            "      -s <seedFile>: robot positions of the formed environment"
+            " (default=%s)\n",
+            program, DEFAULT_MIN_SECONDS * 1e3, DEFAULT_N_ROBOTS,
+            DEFAULT_SEED_FILE);
+}   // printUsage(const char *)
+
+
+
+//
+// int main(argc, argv)
+// Last modified: 19Oct2026
+//
+// Runs the (selected) benchmarks and writes their measurements.
+//
+// Returns:     0 if successful, 1 otherwise
+// Parameters:
+//      argc    in      an argument counter
+//      argv    in      the program arguments
+//
+int main(int argc, char **argv)
+{
+    string outFile, filter, seedFile = DEFAULT_SEED_FILE;
+    double minSeconds = DEFAULT_MIN_SECONDS;
+    GLint  nRobots    = DEFAULT_N_ROBOTS;
+    for (int i = 1; i < argc; ++i)
+    {
+        if      ((!strcmp(argv[i], "-o")) && (i + 1 < argc)) outFile  = argv[++i];
+        else if ((!strcmp(argv[i], "-f")) && (i + 1 < argc)) filter   = argv[++i];
+        else if ((!strcmp(argv[i], "-s")) && (i + 1 < argc)) seedFile = argv[++i];
+        else if ((!strcmp(argv[i], "-m")) && (i + 1 < argc))
+            minSeconds = atof(argv[++i]) / 1e3;
+        else if ((!strcmp(argv[i], "-n")) && (i + 1 < argc))
+            nRobots = atoi(argv[++i]);
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    vector<Benchmark>   benchmarks = getBenchmarks();
+    vector<Measurement> results;
+    for (size_t i = 0; i < benchmarks.size(); ++i)
+    {
+        const Benchmark &b = benchmarks[i];
+        if ((!filter.empty()) && (b.name.find(filter) == string::npos))
+            continue;
+        if ((b.needsEnv) && (g_env == NULL) && (!initEnv(nRobots, seedFile)))
+        {
+            fprintf(stderr, ">> ERROR: Unable to form the environment...\n");
+            return 1;
+        }
+        results.push_back(measure(b, minSeconds));
+        fprintf(stderr, "%-40s %12.1f ns/op %8.2f allocs/op\n",
+                results.back().name.c_str(), results.back().nsPerOp,
+                results.back().allocsPerOp);
+    }
+
+    bool ok;
+    if (outFile.empty()) ok = writeResults(cout, results, false);
+    else
+    {
+        size_t   n    = outFile.size();
+        bool     json = (n >= 5) && (outFile.compare(n - 5, 5, ".json") == 0);
+        ofstream out(outFile.c_str());
+        ok = (out) && (writeResults(out, results, json));
+    }
+    if (!ok) fprintf(stderr, ">> ERROR: Unable to write the results...\n");
+    return ok ? 0 : 1;
+}   // main(int, char **)
@@ -0,0 +1,108 @@
+#!/usr/bin/perl
+#
+# Filename:        "policyBench.pl"
+#
+# Last modified:   19Oct2026
+#
+# Description:     This script benchmarks the auction policies (see
+#                  AuctionPolicy.h) against each other.  Every policy is run
+#                  headless on the same seed files and numbers of robots,
+#                  and the throughput (steps per second) and convergence
+#                  (steps to quiescence, converged cells, messages) of each
+#                  run are written as CSV, followed by a per-policy summary.
+#
+# Usage:           policyBench.pl [--sim <Simulator>] [--n <n1,n2,..>]
+#                                 [--seeds <first..last>] [--policies <p1,..>]
+#                                 [--args "<extra Simulator arguments>"]
+#                                 [--out <csv file>]
+#
+use strict;
+use warnings;
+use Cwd qw(abs_path);
+use File::Basename qw(dirname);
+use File::Temp qw(tempdir);
+use Getopt::Long;
+use Time::HiRes qw(time);
+
+
+my $base      = abs_path(dirname(abs_path($0)) . "/..");
+my $simulator = $base . "/Simulator";
+my $seed_location = $base . "/support/seeds/random_xy_seeds_";
+my $nums      = "20,60,100";
+my $seeds     = "1..3";
+my $policies  = "push,insertion,random-push,random-insertion,hybrid";
+my $args      = "";
+my $out       = "policy_bench.csv";
+
+GetOptions("sim=s"      => \$simulator,
+           "n=s"        => \$nums,
+           "seeds=s"    => \$seeds,
+           "policies=s" => \$policies,
+           "args=s"     => \$args,
+           "out=s"      => \$out) or die "usage: $0 [--sim s] [--n n1,..] [--seeds a..b] [--policies p1,..] [--args a] [--out f]\n";
+$simulator = abs_path($simulator);
+die "simulator '$simulator' not found (make first)\n" unless -x $simulator;
+
+my @nums_of_robots = split(/,/, $nums);
+my @policy_names   = split(/,/, $policies);
+my ($first, $last) = ($seeds =~ /^(\d+)(?:\.\.(\d+))?$/) or die "bad --seeds '$seeds'\n";
+$last = $first unless defined $last;
+
+open(my $csv, ">", $out) or die "unable to open '$out': $!\n";
+print $csv "policy,robots,seed,steps,seconds,steps_per_sec,messages,messages_per_step,converged\n";
+
+my %summary;
+for my $policy (@policy_names){
+    for my $num_robots (@nums_of_robots){
+        for my $seed ($first .. $last){
+            my $run = run_sim($policy, $num_robots, $seed);
+            printf $csv "%s,%d,%d,%d,%.3f,%.1f,%d,%.1f,%d\n",
+                   $policy, $num_robots, $seed, $run->{steps}, $run->{seconds},
+                   $run->{steps} / $run->{seconds}, $run->{messages},
+                   $run->{messages} / ($run->{steps} || 1), $run->{converged};
+            my $s = $summary{$policy}{$num_robots} ||= {};
+            $s->{runs}++;
+            $s->{$_} += $run->{$_} for qw(steps seconds messages converged);
+        }
+    }
+}
+close($csv);
+
+# summarize each policy (means over the seeds)
+printf "%-18s %7s %9s %9s %11s %11s %10s\n",
+       "policy", "robots", "steps", "seconds", "steps/sec", "msgs/step", "converged";
+for my $policy (@policy_names){
+    for my $num_robots (@nums_of_robots){
+        my $s = $summary{$policy}{$num_robots};
+        printf "%-18s %7d %9.1f %9.3f %11.1f %11.1f %9.1f%%\n",
+               $policy, $num_robots, $s->{steps} / $s->{runs},
+               $s->{seconds} / $s->{runs}, $s->{steps} / $s->{seconds},
+               $s->{messages} / ($s->{steps} || 1),
+               100.0 * $s->{converged} / ($s->{runs} * $num_robots);
+    }
+}
+print "per-run results written to $out\n";
+
+
+# runs one headless simulation in a scratch directory,
+# returning its steps, wall-clock seconds, messages, and converged cells
+sub run_sim {
+    my ($policy, $num_robots, $seed) = @_;
+    my $dir = tempdir(CLEANUP => 1);
+    my $sim_call = "cd $dir && " . $simulator . " -g -s " . $seed_location . $seed .
+                   ".txt -n " . $num_robots . " -a " . $policy . " " . $args . " > stdout.out 2>&1";
+    print STDERR "running $policy with $num_robots robots on seed $seed\n";
+    my $start = time();
+    unless(system($sim_call)==0){
+        die "sim did not exit properly: $sim_call\n";
+    }
+    my %run = (seconds => time() - $start, steps => 0, messages => 0, converged => 0);
+    open(my $fh, "<", "$dir/stdout.out") or die "no output from: $sim_call\n";
+    while(<$fh>){
+        $run{steps}     = $1 if /total steps = (\d+)/;
+        $run{messages}  = $1 if /Total Messages sent :\s+(\d+)/;
+        $run{converged} = $1 if /Total Converged Cells:\s+(\d+)/;
+    }
+    close($fh);
+    return \%run;
+}
@@ -1,11 +1,14 @@
 #!/usr/bin/perl
 
-my $randGen = '/home/rlong/git/simulator/support/randGenerator';
+# generates the 30 random seed sets of 1000 robots in a single invocation;
+# pass a base seed as the first argument to produce a different collection
+# (written in the text format under the names of support/seeds, which
+# runSim.pl and policyBench.pl load)
+my $seedGen = 'support/seedgen';
+my $seed    = defined($ARGV[0]) ? $ARGV[0] : 1;
 
-for (1 .. 30){
-    print "on loop # ".$_."\n";
-    my $syscall = $randGen . " 1000 random_xy_seeds_" . $_ . ".txt";
-    unless(system($syscall)==0){
-        die "randGen failed to return properly";
-    }
+my $syscall = $seedGen . " -n 1000 -k 30 -S " . $seed .
+              " -t -o random_xy_seeds_%d.txt";
+unless(system($syscall)==0){
+    die "seedgen failed to return properly";
 }
@@ -0,0 +1,207 @@
+//
+// Filename:        "ringdump.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This program reads the state ring of a running
+//                  simulation (see StateRing.h, "Simulator -M <name>"),
+//                  mapping it read-only, and writes the latest consistent
+//                  state as CSV (step, kind, ID, x, y, heading, radius,
+//                  left and right neighbor IDs, flags, color), or, when
+//                  watching, a summary of each state as it is published.
+//
+
+// preprocessor directives
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../StateRing.h"
+using namespace std;
+
+
+
+// global constants
+static const int MAX_RETRIES   = 1000;    // of a read of a slot
+static const int WATCH_POLL_US = 1000;    // between checks while watching
+
+
+
+// function prototypes
+void printUsage(char **argv);
+bool readLatest(const RingHeader   *header,
+                uint64_t            &n,
+                RingSlot            &slot,
+                vector<RingEntity>  &entities);
+
+
+
+//
+// int main(argc, argv)
+// Last modified: 19Oct2026
+//
+// Parses the arguments, maps the state ring, and writes its latest
+// state (or watches it).
+//
+// Returns:     0 if successful, 1 otherwise
+// Parameters:
+//      argc    in      an argument counter
+//      argv    in      initialization arguments
+//
+int main(int argc, char **argv)
+{
+    string name   = "";
+    int    nWatch = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = i + 1 < argc;
+        if      ((!strcmp(argv[i], "-w")) && (hasValue)) nWatch = atoi(argv[++i]);
+        else if ((name.empty()) && (argv[i][0] != '-'))  name   = argv[i];
+        else
+        {
+            printUsage(argv);
+            return 1;
+        }
+    }
+    if ((name.empty()) || (nWatch < 0))
+    {
+        printUsage(argv);
+        return 1;
+    }
+    if (name[0] != '/') name = "/" + name;
+
+    // map the state ring (read-only)
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    struct stat st;
+    if ((fd < 0) || (fstat(fd, &st) != 0) ||
+        ((size_t)st.st_size < sizeof(RingHeader)))
+    {
+        fprintf(stderr, "%s: no state ring '%s'\n", argv[0], name.c_str());
+        return 1;
+    }
+    void *p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    const RingHeader *header = (const RingHeader *)p;
+    if ((p == MAP_FAILED) || (header->magic != RING_MAGIC) ||
+        (header->version != RING_VERSION) ||
+        (sizeof(RingHeader) + header->nSlots * header->slotSize >
+         (size_t)st.st_size))
+    {
+        fprintf(stderr, "%s: '%s' is not a state ring (version %d)\n",
+                argv[0], name.c_str(), RING_VERSION);
+        return 1;
+    }
+
+    // watch the states as they are published
+    uint64_t           n = 0, last = 0;
+    RingSlot           slot;
+    vector<RingEntity> entities;
+    for (int i = 0; i < nWatch; )
+    {
+        if (header->latest.load(memory_order_acquire) == last)
+        {
+            usleep(WATCH_POLL_US);
+            continue;
+        }
+        if (!readLatest(header, n, slot, entities)) continue;
+        int nCells = 0;
+        for (size_t j = 0; j < entities.size(); ++j)
+            if (entities[j].flags & RING_CELL) ++nCells;
+        printf("state %llu: step %d, %d cells, %d free robots%s\n",
+               (unsigned long long)n, slot.stepCount, nCells,
+               (int)entities.size() - nCells,
+               ((last > 0) && (last + 1 < n)) ? " (states skipped)" : "");
+        last = n;
+        ++i;
+    }
+    if (nWatch > 0) return 0;
+
+    // write the latest state
+    if (!readLatest(header, n, slot, entities))
+    {
+        fprintf(stderr, "%s: no consistent state in '%s'\n",
+                argv[0], name.c_str());
+        return 1;
+    }
+    printf("step,kind,id,x,y,heading,radius,left,right,flags,color\n");
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        const RingEntity &e = entities[i];
+        printf("%d,%c,%d,%.9g,%.9g,%.9g,%.9g,%d,%d,%u,%06x\n",
+               slot.stepCount, (e.flags & RING_CELL) ? 'c' : 'r', e.id,
+               e.x, e.y, e.heading, e.radius, e.leftNbr, e.rightNbr,
+               e.flags, e.color);
+    }
+    return 0;
+}   // main(int, char **)
+
+
+
+//
+// void printUsage(argv)
+// Last modified: 19Oct2026
+//
+// Prints the program usage message.
+//
+// Returns:     <none>
+// Parameters:
+//      argv    in      initialization arguments
+//
+void printUsage(char **argv)
+{
+    fprintf(stderr,
+            "USAGE: %s <name> [-w <nStates>]\n"
+            "      <name>: the state ring (see Simulator -M <name>)\n"
+            "      -w <nStates>: watch <nStates> states as they are"
+            " published,\n"
+            "             instead of writing the latest state as CSV\n",
+            argv[0]);
+}   // printUsage(char **)
+
+
+
+//
+// bool readLatest(header, n, slot, entities)
+// Last modified: 19Oct2026
+//
+// Attempts to copy the latest state published to the parameterized state
+// ring (retrying while it is being rewritten), returning true if
+// successful, false otherwise.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      header      in      the header of the state ring
+//      n           out     the number of the state
+//      slot        out     the slot of the state
+//      entities    out     the entities of the state
+//
+bool readLatest(const RingHeader   *header,
+                uint64_t            &n,
+                RingSlot            &slot,
+                vector<RingEntity>  &entities)
+{
+    for (int i = 0; i < MAX_RETRIES; ++i)
+    {
+        n = header->latest.load(memory_order_acquire);
+        if (n == 0) return false;
+        const RingSlot *s = (const RingSlot *)((const char *)(header + 1) +
+                                               (n % header->nSlots) *
+                                               header->slotSize);
+        uint64_t sequence = s->sequence.load(memory_order_acquire);
+        if (sequence != 2 * n) continue;
+        slot.stepCount = s->stepCount;
+        slot.nEntities = s->nEntities;
+        if (slot.nEntities > header->maxEntities) continue;
+        entities.resize(slot.nEntities);
+        if (slot.nEntities > 0)
+            memcpy(&entities[0], s + 1, slot.nEntities * sizeof(RingEntity));
+        atomic_thread_fence(memory_order_acquire);
+        if (s->sequence.load(memory_order_relaxed) == sequence) return true;
+    }
+    return false;
+}   // readLatest(const RingHeader *, uint64_t &, RingSlot &, ..)
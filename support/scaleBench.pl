@@ -0,0 +1,197 @@
+#!/usr/bin/perl
+#
+# Filename:        "scaleBench.pl"
+#
+# Last modified:   19Oct2026
+#
+# Description:     This script benchmarks the simulation end to end as the
+#                  number of robots grows.  Every (policy, robots, formation)
+#                  run is headless, on a seed file generated (by seedgen)
+#                  from a fixed seed, and is limited to a number of steps
+#                  (so that large runs finish).  The throughput (steps per
+#                  second, from the step profile), time to quiescence (if
+#                  the run quiesced), peak RSS, and messages per step of
+#                  each run are written as CSV and compared against a stored
+#                  baseline; the script fails if the throughput of any run
+#                  falls below the baseline by more than the tolerance.
+#
+# Usage:           scaleBench.pl [--sim <Simulator>] [--seedgen <seedgen>]
+#                                [--n <n1,n2,..>] [--large]
+#                                [--policies <p1,..>] [--formations <f1,..>]
+#                                [--seed <seed>] [--max-steps <steps>]
+#                                [--repeat <runs>] [--baseline <csv file>]
+#                                [--tolerance <fraction>] [--update]
+#                                [--out <csv file>]
+#
+use strict;
+use warnings;
+use Cwd qw(abs_path);
+use File::Basename qw(dirname);
+use File::Temp qw(tempdir);
+use Getopt::Long;
+
+
+my $base       = abs_path(dirname(abs_path($0)) . "/..");
+my $simulator  = $base . "/Simulator";
+my $seedgen    = $base . "/support/seedgen";
+my $nums       = "10,100,1000,10000";
+my $large      = 0;                     # also run 100000 robots
+my $policies   = "push,insertion";
+my $formations = "0,2,6";
+my $seed       = 1;
+my $max_steps  = 500;
+my $repeat     = 3;                     # runs per case (the fastest counts)
+my $baseline   = $base . "/support/scale_baseline.csv";
+my $tolerance  = 0.30;                  # allowed throughput regression
+my $update     = 0;
+my $out        = "scale_bench.csv";
+
+GetOptions("sim=s"        => \$simulator,
+           "seedgen=s"    => \$seedgen,
+           "n=s"          => \$nums,
+           "large"        => \$large,
+           "policies=s"   => \$policies,
+           "formations=s" => \$formations,
+           "seed=i"       => \$seed,
+           "max-steps=i"  => \$max_steps,
+           "repeat=i"     => \$repeat,
+           "baseline=s"   => \$baseline,
+           "tolerance=f"  => \$tolerance,
+           "update"       => \$update,
+           "out=s"        => \$out) or die "usage: $0 [--sim s] [--seedgen s] [--n n1,..] [--large] [--policies p1,..] [--formations f1,..] [--seed s] [--max-steps m] [--repeat r] [--baseline f] [--tolerance t] [--update] [--out f]\n";
+$simulator = abs_path($simulator);
+$seedgen   = abs_path($seedgen);
+die "simulator '$simulator' not found (make first)\n"        unless -x $simulator;
+die "seedgen '$seedgen' not found (make seedgen first)\n"    unless -x $seedgen;
+
+my @nums_of_robots  = split(/,/, $nums);
+push(@nums_of_robots, 100000) if $large;
+my @policy_names    = split(/,/, $policies);
+my @formation_index = split(/,/, $formations);
+
+# generate the seed file of each number of robots (from the fixed seed)
+my $seed_dir = tempdir(CLEANUP => 1);
+my %seed_file;
+for my $num_robots (@nums_of_robots){
+    my $pattern = "$seed_dir/scale_${num_robots}_%d.seed";
+    system("$seedgen -n $num_robots -S $seed -o $pattern > /dev/null") == 0
+        or die "unable to generate seeds for $num_robots robots\n";
+    $seed_file{$num_robots} = sprintf($pattern, 1);
+}
+
+my %expected = read_baseline($baseline);
+open(my $csv, ">", $out) or die "unable to open '$out': $!\n";
+print $csv "policy,robots,formation,steps,quiesced,steps_per_sec,seconds_to_quiescence,peak_rss_kb,messages_per_step\n";
+printf "%-10s %7s %4s %6s %11s %11s %10s %10s %9s\n",
+       "policy", "robots", "f", "steps", "steps/sec", "quiesce(s)",
+       "rss(kB)", "msgs/step", "baseline";
+
+my ($n_regressions, %results) = (0);
+for my $policy (@policy_names){
+    for my $num_robots (@nums_of_robots){
+        for my $f (@formation_index){
+            my $run;
+            for (1 .. $repeat){
+                my $r = run_sim($policy, $num_robots, $f);
+                $run = $r if (!defined $run) || ($r->{steps_per_sec} > $run->{steps_per_sec});
+            }
+            my $key = "$policy,$num_robots,$f";
+            $results{$key} = $run->{steps_per_sec};
+            my $quiesce = $run->{quiesced} ? sprintf("%.3f", $run->{seconds}) : "";
+            printf $csv "%s,%d,%d,%d,%d,%.1f,%s,%d,%.1f\n",
+                   $policy, $num_robots, $f, $run->{steps}, $run->{quiesced},
+                   $run->{steps_per_sec}, $quiesce, $run->{peak_rss_kb},
+                   $run->{messages} / ($run->{steps} || 1);
+
+            my $verdict = "-";
+            if (exists $expected{$key}){
+                my $ratio = $run->{steps_per_sec} / ($expected{$key} || 1);
+                $verdict = sprintf("%+.0f%%", 100.0 * ($ratio - 1.0));
+                if ($ratio < 1.0 - $tolerance){
+                    $verdict .= " FAIL";
+                    $n_regressions++;
+                }
+            }
+            printf "%-10s %7d %4d %6d %11.1f %11s %10d %10.1f %9s\n",
+                   $policy, $num_robots, $f, $run->{steps},
+                   $run->{steps_per_sec}, ($quiesce eq "") ? "-" : $quiesce,
+                   $run->{peak_rss_kb}, $run->{messages} / ($run->{steps} || 1),
+                   $verdict;
+        }
+    }
+}
+close($csv);
+print "per-run results written to $out\n";
+
+if ($update){
+    write_baseline($baseline, \%expected, \%results);
+    print "baseline written to $baseline\n";
+    exit(0);
+}
+if ($n_regressions > 0){
+    printf "%d run(s) regressed by more than %.0f%% against %s\n",
+           $n_regressions, 100.0 * $tolerance, $baseline;
+    exit(1);
+}
+exit(0);
+
+
+# runs one headless simulation in a scratch directory, returning its
+# steps, whether it quiesced, its step time and throughput, its peak RSS,
+# and its messages
+sub run_sim {
+    my ($policy, $num_robots, $f) = @_;
+    my $dir = tempdir(CLEANUP => 1);
+    my $sim_call = "cd $dir && $simulator -g -n $num_robots -a $policy -f $f" .
+                   " -s $seed_file{$num_robots} -m $max_steps -p profile.json" .
+                   " > stdout.out 2>&1";
+    print STDERR "running $policy with $num_robots robots on formation $f\n";
+    system($sim_call) == 0 or die "sim did not exit properly: $sim_call\n";
+
+    my %run = (steps => 0, seconds => 0.0, peak_rss_kb => 0, messages => 0);
+    open(my $fh, "<", "$dir/profile.json") or die "no profile from: $sim_call\n";
+    while(<$fh>){
+        $run{steps}       = $1 if /"steps":\s*(\d+)/;
+        $run{seconds}     = $1 if /"step_seconds":\s*([\d.eE+-]+)/;
+        $run{peak_rss_kb} = $1 if /"peak_rss_kb":\s*(\d+)/;
+    }
+    close($fh);
+    open($fh, "<", "$dir/stdout.out") or die "no output from: $sim_call\n";
+    while(<$fh>){
+        $run{messages} = $1 if /Total Messages sent :\s+(\d+)/;
+    }
+    close($fh);
+    $run{quiesced}      = ($run{steps} < $max_steps) ? 1 : 0;
+    $run{steps_per_sec} = $run{steps} / ($run{seconds} || 1e-9);
+    return \%run;
+}
+
+
+# reads the throughput (steps per second) of each run in the baseline
+sub read_baseline {
+    my ($file) = @_;
+    my %expected;
+    open(my $fh, "<", $file) or return %expected;
+    while(<$fh>){
+        next if /^policy,/;
+        chomp;
+        my ($policy, $num_robots, $f, $steps_per_sec) = split(/,/);
+        $expected{"$policy,$num_robots,$f"} = $steps_per_sec if defined $steps_per_sec;
+    }
+    close($fh);
+    return %expected;
+}
+
+
+# writes the baseline (the runs just measured replace their old entries)
+sub write_baseline {
+    my ($file, $expected, $results) = @_;
+    my %merged = (%$expected, %$results);
+    open(my $fh, ">", $file) or die "unable to open '$file': $!\n";
+    print $fh "policy,robots,formation,steps_per_sec\n";
+    for my $key (sort { my @a = split(/,/, $a); my @b = split(/,/, $b);
+                        ($a[0] cmp $b[0]) || ($a[1] <=> $b[1]) || ($a[2] <=> $b[2]) } keys %merged){
+        printf $fh "%s,%.1f\n", $key, $merged{$key};
+    }
+    close($fh);
+}
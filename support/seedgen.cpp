@@ -0,0 +1,379 @@
+//
+// Filename:        "seedgen.cpp"
+//
+// Last modified:   19Oct2026
+//
+// Description:     This program generates sets of initial robot positions
+//                  (seeds) uniformly within the unit disk.  Every set is
+//                  reproducible from an explicit seed, an optional minimum
+//                  separation (Poisson-disk) constraint is enforced with a
+//                  spatial grid, and the output is written in the binary
+//                  seed format (or the legacy one-value-per-line format).
+//
+
+// preprocessor directives
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../SeedFile.h"
+using namespace std;
+
+
+
+// global constants
+static const unsigned long long DEFAULT_SEED     = 1ULL;
+static const int                DEFAULT_N_SETS   = 1;
+static const int                MAX_ATTEMPTS     = 1000;   // per position
+static const char               DEFAULT_PATTERN[] = "random_xy_seeds_%d.seed";
+
+
+
+//
+// unsigned long long splitmix64(x)
+// Last modified: 19Oct2026
+//
+// Returns the parameterized value mixed by splitmix64 (a bijection, so
+// distinct values give distinct, unrelated results).
+//
+// Returns:     the mixed value
+// Parameters:
+//      x       in      the value being mixed
+//
+static unsigned long long splitmix64(unsigned long long x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}   // splitmix64(unsigned long long)
+
+
+
+// describes a small, fast pseudorandom number generator (xoshiro128+
+// state initialized by splitmix64) so that each seed set is independent
+// of the platform rand() implementation
+class Random
+{
+    public:
+
+        //
+        // Random(seed)
+        // Last modified: 19Oct2026
+        //
+        // Constructor that initializes the generator from the parameterized
+        // seed, expanding it with splitmix64.
+        //
+        // Returns:     <none>
+        // Parameters:
+        //      seed    in      the seed of the generator
+        //
+        Random(unsigned long long seed)
+        {
+            for (int i = 0; i < 4; i += 2)
+            {
+                unsigned long long z = (seed += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                z =  z ^ (z >> 31);
+                s[i]     = (unsigned int)z;
+                s[i + 1] = (unsigned int)(z >> 32);
+            }
+            if (!(s[0] | s[1] | s[2] | s[3])) s[0] = 1;
+        }   // Random(unsigned long long)
+
+        //
+        // unsigned int next()
+        // Last modified: 19Oct2026
+        //
+        // Returns the next 32-bit pseudorandom number.
+        //
+        // Returns:     the next 32-bit pseudorandom number
+        // Parameters:  <none>
+        //
+        unsigned int next()
+        {
+            unsigned int result = s[0] + s[3], t = s[1] << 9;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3]  = (s[3] << 11) | (s[3] >> 21);
+            return result;
+        }   // next()
+
+        //
+        // float uniform(min, max)
+        // Last modified: 19Oct2026
+        //
+        // Returns a floating-point number [min, max).
+        //
+        // Returns:     a floating-point number [min, max)
+        // Parameters:
+        //      min     in      the minimum of the number being returned
+        //      max     in      the maximum of the number being returned
+        //
+        float uniform(const float min, const float max)
+        {
+            return min + (max - min) * (float)(next() >> 8) * (1.0f / 16777216.0f);
+        }   // uniform(const float, const float)
+
+    protected:
+
+        // <protected data members>
+        unsigned int s[4];
+};  // Random
+
+
+
+// describes a uniform grid over the disk that admits at most one
+// position per cell, used to enforce the minimum separation
+class SeparationGrid
+{
+    public:
+
+        //
+        // SeparationGrid(r, d)
+        // Last modified: 19Oct2026
+        //
+        // Constructor that covers a disk of the parameterized radius with
+        // cells of side d / sqrt(2), so that no two positions closer than
+        // d can share a cell (a single cell if d is not positive).
+        //
+        // Returns:     <none>
+        // Parameters:
+        //      r       in      the radius of the disk
+        //      d       in      the minimum separation between positions
+        //
+        SeparationGrid(const float r, const float d)
+            : radius(r), minSep2(d * d),
+              cellSize((d > 0.0f) ? d / sqrt(2.0f) : 2.0f * r)
+        {
+            side = (int)ceil(2.0f * r / cellSize) + 1;
+            cells.assign((size_t)side * side, -1);
+        }   // SeparationGrid(const float, const float)
+
+        //
+        // bool tryInsert(xy, x, y)
+        // Last modified: 19Oct2026
+        //
+        // Inserts the parameterized position if it is at least the minimum
+        // separation from every position already in the grid, returning
+        // true if inserted, false otherwise.
+        //
+        // Returns:     true if inserted, false otherwise
+        // Parameters:
+        //      xy      in/out  the interleaved positions
+        //      x       in      the x-coordinate of the position
+        //      y       in      the y-coordinate of the position
+        //
+        bool tryInsert(vector<float> &xy, const float x, const float y)
+        {
+            int cx = cellOf(x), cy = cellOf(y);
+            for (int j = max(0, cy - 2); j <= min(side - 1, cy + 2); ++j)
+                for (int i = max(0, cx - 2); i <= min(side - 1, cx + 2); ++i)
+                {
+                    int k = cells[(size_t)j * side + i];
+                    if (k < 0) continue;
+                    float dx = xy[2 * k] - x, dy = xy[2 * k + 1] - y;
+                    if (dx * dx + dy * dy < minSep2) return false;
+                }
+            cells[(size_t)cy * side + cx] = (int)(xy.size() / 2);
+            xy.push_back(x);
+            xy.push_back(y);
+            return true;
+        }   // tryInsert(vector<float> &, const float, const float)
+
+    protected:
+
+        // <protected data members>
+        float       radius, minSep2, cellSize;
+        int         side;
+        vector<int> cells;
+
+        //
+        // int cellOf(c)
+        // Last modified: 19Oct2026
+        //
+        // Returns the grid index of the parameterized coordinate.
+        //
+        // Returns:     the grid index of the coordinate
+        // Parameters:
+        //      c       in      the coordinate
+        //
+        int cellOf(const float c) const
+        {
+            return min(side - 1, max(0, (int)((c + radius) / cellSize)));
+        }   // cellOf(const float) const
+};  // SeparationGrid
+
+
+
+// function prototypes
+void printUsage(char **argv);
+bool generateSet(const unsigned long long seed,
+                 const int                n,
+                 const float              radius,
+                 const float              minSep,
+                 vector<float>            &xy);
+
+
+
+//
+// int main(argc, argv)
+// Last modified: 19Oct2026
+//
+// Parses the arguments and generates each requested seed set.
+//
+// Returns:     0 if successful, 1 otherwise
+// Parameters:
+//      argc    in      an argument counter
+//      argv    in      initialization arguments
+//
+int main(int argc, char **argv)
+{
+    unsigned long long seed    = DEFAULT_SEED;
+    int                n       = -1,   nSets = DEFAULT_N_SETS, first = 1;
+    float              radius  = 1.0f, minSep = 0.0f;
+    bool               text    = false;
+    string             pattern = DEFAULT_PATTERN;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = i + 1 < argc;
+        if      ((!strcmp(argv[i], "-n")) && (hasValue)) n      = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-k")) && (hasValue)) nSets  = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-b")) && (hasValue)) first  = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-S")) && (hasValue)) seed   = strtoull(argv[++i], NULL, 10);
+        else if ((!strcmp(argv[i], "-d")) && (hasValue)) minSep = (float)atof(argv[++i]);
+        else if ((!strcmp(argv[i], "-r")) && (hasValue)) radius = (float)atof(argv[++i]);
+        else if ((!strcmp(argv[i], "-o")) && (hasValue)) pattern = argv[++i];
+        else if  (!strcmp(argv[i], "-t"))                text   = true;
+        else
+        {
+            printUsage(argv);
+            return 1;
+        }
+    }
+    if ((n < 1) || (nSets < 1) || (radius <= 0.0f) || (minSep < 0.0f))
+    {
+        printUsage(argv);
+        return 1;
+    }
+
+    vector<float> xy;
+    xy.reserve(2 * (size_t)n);
+    for (int k = first; k < first + nSets; ++k)
+    {
+
+        // each set is seeded independently so any one can be regenerated;
+        // the base seed and set are mixed (rather than added) so that
+        // different base seeds give unrelated collections
+        if (!generateSet(splitmix64(splitmix64(seed) ^ (unsigned long long)k),
+                         n, radius, minSep, xy))
+        {
+            fprintf(stderr, ">> ERROR: Unable to place %d positions with "
+                            "separation %g in set %d.\n", n, minSep, k);
+            return 1;
+        }
+
+        char filename[1024];
+        snprintf(filename, sizeof(filename), pattern.c_str(), k);
+        bool ok = text ? SeedFile::writeText(filename, xy) :
+                         SeedFile::writeBinary(filename, xy);
+        if (!ok)
+        {
+            fprintf(stderr, ">> ERROR: Unable to write '%s'.\n", filename);
+            return 1;
+        }
+    }
+    return 0;
+}   // main(int, char **)
+
+
+
+//
+// void printUsage(argv)
+// Last modified: 19Oct2026
+//
+// Prints the program usage message.
+//
+// Returns:     <none>
+// Parameters:
+//      argv    in      initialization arguments
+//
+void printUsage(char **argv)
+{
+    fprintf(stderr,
+            "USAGE: %s -n <nRobots> [-k <nSets>] [-b <firstSet>] [-S <seed>]"
+            " [-d <minSep>] [-r <radius>] [-o <pattern>] [-t]\n"
+            "      -n <nRobots>: number of positions per set\n"
+            "      -k <nSets>: number of sets to generate (default=1)\n"
+            "      -b <firstSet>: index of the first set (default=1)\n"
+            "      -S <seed>: base seed; set k uses a mix of seed and k"
+            " (default=1)\n"
+            "      -d <minSep>: minimum separation between positions"
+            " (default=0)\n"
+            "      -r <radius>: radius of the disk (default=1.0)\n"
+            "      -o <pattern>: printf-style output filename pattern"
+            " (default=%s)\n"
+            "      -t: write the text format instead of the binary format\n",
+            argv[0], DEFAULT_PATTERN);
+}   // printUsage(char **)
+
+
+
+//
+// bool generateSet(seed, n, radius, minSep, xy)
+// Last modified: 19Oct2026
+//
+// Generates n positions uniformly within a disk of the parameterized radius
+// by rejection sampling; the first position is always the origin (the seed
+// robot).  If minSep is positive, candidates closer than minSep to an
+// existing position are rejected as well, returning false if the disk is
+// too crowded to place every position.
+//
+// Returns:     true if successful, false otherwise
+// Parameters:
+//      seed    in      the seed of this set
+//      n       in      the number of positions
+//      radius  in      the radius of the disk
+//      minSep  in      the minimum separation between positions
+//      xy      out     the interleaved positions
+//
+bool generateSet(const unsigned long long seed,
+                 const int                n,
+                 const float              radius,
+                 const float              minSep,
+                 vector<float>            &xy)
+{
+    Random         rng(seed);
+    SeparationGrid grid(radius, minSep);
+    float          r2 = radius * radius;
+
+    xy.clear();
+    grid.tryInsert(xy, 0.0f, 0.0f);
+    while ((int)(xy.size() / 2) < n)
+    {
+        bool placed = false;
+        for (int attempt = 0; (!placed) && (attempt < MAX_ATTEMPTS); ++attempt)
+        {
+            float x = rng.uniform(-radius, radius),
+                  y = rng.uniform(-radius, radius);
+            if (x * x + y * y > r2) continue;
+            if (minSep > 0.0f) placed = grid.tryInsert(xy, x, y);
+            else
+            {
+                xy.push_back(x);
+                xy.push_back(y);
+                placed = true;
+            }
+        }
+        if (!placed) return false;
+    }
+    return true;
+}   // generateSet(const unsigned long long, const int, const float,
+    //             const float, vector<float> &)